@@ -0,0 +1,461 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    block_write_queue.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/core/utility/Progress_Callback.hpp>
+#include <terminus/core/work/Thread.hpp>
+#include <terminus/error.hpp>
+#include <terminus/log/utility.hpp>
+#include <terminus/math/Point_Utilities.hpp>
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
+
+// Terminus Image Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_resource_base.hpp>
+#include <terminus/image/types/image_traits.hpp>
+
+namespace tmns::image::io {
+
+/**
+ * Default number of rasterization threads used when writing an image in blocks.
+*/
+inline size_t default_block_write_threads()
+{
+    return std::max( (int)std::thread::hardware_concurrency() / 4, 2 );
+}
+
+/**
+ * Writes an image to one or more resources block-by-block.
+ *
+ * Blocks are rasterized concurrently by a set of worker threads, but are handed
+ * to each resource strictly in row-major order by a single writer thread per resource,
+ * so drivers never see concurrent or out-of-order writes.  Workers may only run ahead
+ * of the slowest writer by a fixed number of blocks, so memory use is bounded by
+ * (max_blocks_in_flight * block size) regardless of the image size.
+ *
+ * When given one resource per image plane, each block is rasterized once and plane
+ * @a p of the block is written to resource @a p.  The resources are written in parallel.
+ *
+ * If the image can report empty regions (see Has_Empty_Regions), empty blocks are not
+ * rasterized.  They are written from a single shared fill block instead.
+*/
+template <typename ImageT>
+class Block_Write_Queue
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Block Type
+        typedef Image_Memory<pixel_type> block_type;
+
+        /**
+         * Constructor
+         *
+         * @param resource Destination resource
+         * @param image Source image view
+         * @param block_size Size of each block handed to the resource
+         * @param num_threads Number of rasterization threads
+         * @param max_blocks_in_flight Maximum number of blocks rasterized but not yet written.
+         *                             Zero picks twice the thread count.
+        */
+        Block_Write_Queue( Write_Image_Resource_Base::ptr_t resource,
+                           const ImageT&                    image,
+                           const math::Size2i&              block_size,
+                           size_t                           num_threads          = default_block_write_threads(),
+                           size_t                           max_blocks_in_flight = 0 )
+          : Block_Write_Queue( std::vector<Write_Image_Resource_Base::ptr_t>( { resource } ),
+                               image,
+                               block_size,
+                               num_threads,
+                               max_blocks_in_flight ) {}
+
+        /**
+         * Constructor for writing each image plane to its own resource
+         *
+         * @param resources Destination resources.  Either a single resource, or one per image plane.
+         * @param image Source image view
+         * @param block_size Size of each block handed to the resources
+         * @param num_threads Number of rasterization threads
+         * @param max_blocks_in_flight Maximum number of blocks rasterized but not yet written.
+         *                             Zero picks twice the thread count.
+        */
+        Block_Write_Queue( const std::vector<Write_Image_Resource_Base::ptr_t>& resources,
+                           const ImageT&                                        image,
+                           const math::Size2i&                                  block_size,
+                           size_t                                               num_threads          = default_block_write_threads(),
+                           size_t                                               max_blocks_in_flight = 0 )
+          : m_resources( resources ),
+            m_image( image ),
+            m_num_threads( std::max<size_t>( num_threads, 1 ) ),
+            m_max_in_flight( max_blocks_in_flight > 0 ? max_blocks_in_flight : 2 * m_num_threads ),
+            m_commits( resources.size(), 0 )
+        {
+            const int rows = image.rows();
+            const int cols = image.cols();
+            for( int j = 0; j < rows; j += block_size.height() ) {
+            for( int i = 0; i < cols; i += block_size.width()  ) {
+                m_bboxes.push_back( math::Rect2i( math::ToPoint2<int>( i, j ),
+                                                  math::ToPoint2<int>( std::min( i + block_size.width(),  cols ),
+                                                                       std::min( j + block_size.height(), rows ) ) ) );
+            }}
+
+            if constexpr( Has_Empty_Regions<ImageT>::value::value )
+            {
+                if( !image.has_empty_regions() )
+                {
+                    return;
+                }
+                m_empty.resize( m_bboxes.size(), false );
+                for( size_t index = 0; index < m_bboxes.size(); ++index )
+                {
+                    m_empty[index] = image.is_empty( m_bboxes[index] );
+                    if( m_empty[index] && !m_fill_block )
+                    {
+                        m_fill_block = std::make_shared<block_type>( block_size.width(),
+                                                                     block_size.height(),
+                                                                     image.planes() );
+                        const auto fill = image.fill_pixel();
+                        for( size_t p = 0; p < image.planes(); ++p ) {
+                        for( int y = 0; y < block_size.height(); ++y ) {
+                        for( int x = 0; x < block_size.width();  ++x ) {
+                            (*m_fill_block)( x, y, p ) = fill;
+                        }}}
+                    }
+                }
+            }
+        }
+
+        /**
+         * Get the number of blocks which will be written
+        */
+        size_t num_blocks() const
+        {
+            return m_bboxes.size();
+        }
+
+        /**
+         * Rasterize and write all blocks.  Progress is reported from the calling thread
+         * as blocks are committed to every resource.
+        */
+        Result<void> operator()( core::utility::Progress_Callback& progress_callback )
+        {
+            if( m_resources.size() != 1 && m_resources.size() != m_image.planes() )
+            {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "Expected 1 or ", m_image.planes(), " resources, got ",
+                                      m_resources.size() );
+            }
+
+            std::vector<std::shared_ptr<Rasterize_Thread>>   generators;
+            std::vector<std::shared_ptr<Commit_Thread>>      writers;
+            std::vector<std::shared_ptr<core::work::Thread>> threads;
+            for( size_t i = 0; i < m_num_threads; ++i )
+            {
+                auto generator = std::make_shared<Rasterize_Thread>( *this );
+                generators.push_back( generator );
+                threads.push_back( std::make_shared<core::work::Thread>( generator ) );
+            }
+            for( size_t i = 0; i < m_resources.size(); ++i )
+            {
+                auto writer = std::make_shared<Commit_Thread>( *this, i );
+                writers.push_back( writer );
+                threads.push_back( std::make_shared<core::work::Thread>( writer ) );
+            }
+
+            auto result = monitor( progress_callback );
+
+            // Release any workers still waiting on the window
+            stop();
+            for( auto& thread : threads )
+            {
+                thread->join();
+            }
+            return result;
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Block_Write_Queue";
+        }
+
+    private:
+
+        /**
+         * Worker which pulls the next block index and rasterizes it.
+        */
+        class Rasterize_Thread
+        {
+            public:
+
+                Rasterize_Thread( Block_Write_Queue& queue ) : m_queue( queue ) {}
+
+                void operator()()
+                {
+                    while( true )
+                    {
+                        size_t index;
+                        {
+                            std::unique_lock<std::mutex> lock( m_queue.m_mutex );
+                            m_queue.m_cond.wait( lock, [this]{ return m_queue.worker_may_proceed(); } );
+                            if( m_queue.m_stop || m_queue.m_next_block >= m_queue.m_bboxes.size() )
+                            {
+                                return;
+                            }
+                            index = m_queue.m_next_block++;
+                        }
+
+                        std::shared_ptr<block_type> block;
+                        if( !m_queue.m_empty.empty() && m_queue.m_empty[index] )
+                        {
+                            block = m_queue.m_fill_block;
+                        }
+                        else
+                        {
+                            try
+                            {
+                                block = std::make_shared<block_type>( crop_image( m_queue.m_image,
+                                                                                  m_queue.m_bboxes[index] ) );
+                            }
+                            catch( const std::exception& e )
+                            {
+                                m_queue.set_error( outcome::fail( error::Error_Code::UNKNOWN,
+                                                                  "Failed to rasterize image block: ", e.what() ) );
+                                return;
+                            }
+                        }
+
+                        {
+                            std::unique_lock<std::mutex> lock( m_queue.m_mutex );
+                            m_queue.m_ready[index] = block;
+                        }
+                        m_queue.m_cond.notify_all();
+                    }
+                }
+
+            private:
+
+                Block_Write_Queue& m_queue;
+
+        }; // End of Rasterize_Thread class
+
+        /**
+         * Writer which passes blocks, in order, to a single resource.
+        */
+        class Commit_Thread
+        {
+            public:
+
+                Commit_Thread( Block_Write_Queue& queue,
+                               size_t             resource_index )
+                  : m_queue( queue ),
+                    m_resource_index( resource_index ) {}
+
+                void operator()()
+                {
+                    auto& resource = m_queue.m_resources[m_resource_index];
+                    for( size_t index = 0; index < m_queue.m_bboxes.size(); ++index )
+                    {
+                        std::shared_ptr<block_type> block;
+                        {
+                            std::unique_lock<std::mutex> lock( m_queue.m_mutex );
+                            m_queue.m_cond.wait( lock, [&]{ return m_queue.m_stop || m_queue.m_ready.count( index ) > 0; } );
+                            if( m_queue.m_stop )
+                            {
+                                return;
+                            }
+                            block = m_queue.m_ready[index];
+                        }
+
+                        tmns::log::trace( "writing block ", index + 1, " of ", m_queue.m_bboxes.size(),
+                                          " at ", m_queue.m_bboxes[index].to_string(),
+                                          " to resource ", m_resource_index );
+
+                        Image_Buffer buffer = block->buffer();
+                        if( block == m_queue.m_fill_block )
+                        {
+                            buffer = buffer.cropped( math::Rect2i( 0,
+                                                                   0,
+                                                                   m_queue.m_bboxes[index].width(),
+                                                                   m_queue.m_bboxes[index].height() ) );
+                        }
+                        if( m_queue.m_resources.size() > 1 )
+                        {
+                            buffer = buffer.plane( m_resource_index );
+                        }
+                        auto result = resource->write( buffer, m_queue.m_bboxes[index] );
+                        block.reset();
+
+                        if( result.has_error() )
+                        {
+                            m_queue.set_error( outcome::fail( result.error() ) );
+                            return;
+                        }
+                        m_queue.commit( m_resource_index );
+                    }
+                }
+
+            private:
+
+                Block_Write_Queue& m_queue;
+
+                size_t m_resource_index;
+
+        }; // End of Commit_Thread class
+
+        /**
+         * Wait for blocks to be committed, reporting progress and checking for aborts.
+         * Runs on the calling thread.
+        */
+        Result<void> monitor( core::utility::Progress_Callback& progress_callback )
+        {
+            size_t reported = 0;
+            while( reported < m_bboxes.size() )
+            {
+                {
+                    std::unique_lock<std::mutex> lock( m_mutex );
+                    m_cond.wait( lock, [&]{ return m_stop || min_commit() > reported; } );
+                    if( m_stop )
+                    {
+                        return m_result;
+                    }
+                    reported = min_commit();
+                }
+
+                progress_callback.report_progress( float( reported ) / float( m_bboxes.size() ) );
+                if( progress_callback.abort_requested() )
+                {
+                    return outcome::fail( core::error::ErrorCode::ABORTED,
+                                          "Aborted by ProgressCallback" );
+                }
+            }
+            return outcome::ok();
+        }
+
+        /**
+         * Record that a resource finished writing its next block, releasing
+         * any blocks which every resource has now written.
+        */
+        void commit( size_t resource_index )
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                ++m_commits[resource_index];
+                const size_t done = min_commit();
+                while( !m_ready.empty() && m_ready.begin()->first < done )
+                {
+                    m_ready.erase( m_ready.begin() );
+                }
+            }
+            m_cond.notify_all();
+        }
+
+        /**
+         * Number of blocks written to every resource.  Must hold m_mutex.
+        */
+        size_t min_commit() const
+        {
+            return *std::min_element( m_commits.begin(), m_commits.end() );
+        }
+
+        /**
+         * Check if a worker can claim another block.  Must hold m_mutex.
+        */
+        bool worker_may_proceed() const
+        {
+            return m_stop ||
+                   m_next_block >= m_bboxes.size() ||
+                   m_next_block < min_commit() + m_max_in_flight;
+        }
+
+        /**
+         * Record a worker failure and wake everyone
+        */
+        void set_error( Result<void> result )
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                if( !m_stop )
+                {
+                    m_result = std::move( result );
+                }
+                m_stop = true;
+            }
+            m_cond.notify_all();
+        }
+
+        /**
+         * Stop all workers
+        */
+        void stop()
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_stop = true;
+            }
+            m_cond.notify_all();
+        }
+
+        /// Destination resources
+        std::vector<Write_Image_Resource_Base::ptr_t> m_resources;
+
+        /// Source image
+        const ImageT& m_image;
+
+        /// Block regions, in write order
+        std::vector<math::Rect2i> m_bboxes;
+
+        /// Blocks which hold no data.  Empty unless the image can report empty regions.
+        std::vector<bool> m_empty;
+
+        /// Constant block written in place of every empty block
+        std::shared_ptr<block_type> m_fill_block;
+
+        /// Number of rasterization threads
+        size_t m_num_threads;
+
+        /// Maximum number of blocks rasterized but not yet written
+        size_t m_max_in_flight;
+
+        /// Shared state, protected by m_mutex
+        std::mutex                                     m_mutex;
+        std::condition_variable                        m_cond;
+        size_t                                         m_next_block { 0 };
+        std::vector<size_t>                            m_commits;
+        bool                                           m_stop { false };
+        Result<void>                                   m_result { outcome::ok() };
+        std::map<size_t,std::shared_ptr<block_type>>   m_ready;
+
+}; // End of Block_Write_Queue class
+
+} // End of tmns::image::io namespace
@@ -18,11 +18,16 @@
 #include <terminus/error.hpp>
 #include <terminus/image/io/image_resource_disk.hpp>
 #include <terminus/image/io/drivers/gdal/image_resource_disk_gdal_factory.hpp>
+#include <terminus/image/io/drivers/raw/image_resource_disk_raw_factory.hpp>
 #include <terminus/image/io/drivers/driver_factory_base.hpp>
+#include <terminus/image/io/drivers/resource_handle_cache.hpp>
 
 // C++ Libraries
 #include <deque>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace tmns::image::io {
 
@@ -54,6 +59,7 @@ class Disk_Driver_Manager : boost::noncopyable
 
             // Register each driver
             instance->register_read_driver_factory( std::make_shared<gdal::Image_Resource_Disk_GDAL_Factory>() );
+            instance->register_read_driver_factory( std::make_shared<raw::Image_Resource_Disk_Raw_Factory>() );
 
             return instance;
         }
@@ -70,6 +76,7 @@ class Disk_Driver_Manager : boost::noncopyable
 
             // Register each driver
             instance->register_write_driver_factory( std::make_shared<gdal::Image_Resource_Disk_GDAL_Factory>() );
+            instance->register_write_driver_factory( std::make_shared<raw::Image_Resource_Disk_Raw_Factory>() );
 
             return instance;
         }
@@ -85,7 +92,15 @@ class Disk_Driver_Manager : boost::noncopyable
         void register_write_driver_factory( FactoryT instance );
 
         /**
-         * Select a driver based on the file.
+         * Set the cache of open read resources.  Defaults to the process-wide
+         * Resource_Handle_Cache::instance().  Pass nullptr to always open a new resource.
+        */
+        void set_handle_cache( Resource_Handle_Cache::ptr_t cache );
+
+        /**
+         * Select a driver based on the file.  Files already open in the handle cache
+         * are returned without probing the factories.  Files whose extension and leading
+         * bytes match a previously opened file go straight to the factory which opened it.
         */
         Result<DriverT> pick_read_driver( const std::filesystem::path& pathname ) const;
 
@@ -102,10 +117,41 @@ class Disk_Driver_Manager : boost::noncopyable
         /// Default Constructor
         Disk_Driver_Manager() = default;
 
+        /**
+         * Open a file with the factory at the given index and cache the handle
+        */
+        Result<DriverT> open_read_driver( size_t                       index,
+                                          const std::filesystem::path& pathname,
+                                          const std::string&           driver_key ) const;
+
+        /**
+         * Build the probe-cache key from the extension and leading bytes of a file
+        */
+        static std::string probe_signature( const std::filesystem::path& pathname );
+
+        /**
+         * Probe-cache access, shared across managers
+        */
+        static std::string probe_cache_find( const std::string& signature );
+        static void probe_cache_insert( const std::string& signature,
+                                        const std::string& driver_key );
+        static void probe_cache_erase( const std::string& signature );
+        static std::unordered_map<std::string,std::string>& probe_cache();
+        static std::mutex& probe_cache_mutex();
+
+        /// Number of leading bytes used to identify a file format
+        static constexpr size_t PROBE_MAGIC_BYTES = 16;
+
+        /// Probe-cache size at which it is flushed
+        static constexpr size_t MAX_PROBE_CACHE_ENTRIES = 4096;
+
         /// List of Drivers
         std::deque<FactoryT> m_read_driver_factories;
         std::deque<FactoryT> m_write_driver_factories;
 
+        /// Open read resources, shared between managers
+        Resource_Handle_Cache::ptr_t m_handle_cache { Resource_Handle_Cache::instance() };
+
 }; // End of Disk_Driver_Manager Class
 
 } // end of tmns::image::io namespace
\ No newline at end of file
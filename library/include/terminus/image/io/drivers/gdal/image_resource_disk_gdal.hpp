@@ -17,8 +17,10 @@
 // Terminus Libraries
 #include <terminus/image/io/image_resource_disk.hpp>
 #include <terminus/image/io/drivers/gdal/gdal_codes.hpp>
+#include <terminus/image/pixel/palette.hpp>
 
 // C++ Libraries
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -100,6 +102,38 @@ class Image_Resource_Disk_GDAL : public Image_Resource_Disk
         Result<void> read( const Image_Buffer& dest,
                            const math::Rect2i& bbox ) const override;
 
+        /**
+         * Get the metadata.  The dataset metadata is read from GDAL on the first call.
+        */
+        meta::Metadata_Container_Base::ptr_t metadata() const override;
+
+        /**
+         * Get the metadata for a single GDAL metadata domain, such as "json:ISIS3".
+         * Only that domain is parsed.
+        */
+        Result<meta::Metadata_Container_Base::ptr_t> domain_metadata( const std::string& domain ) const;
+
+        /**
+         * Read the raw indices of a paletted image as GRAY u8, rather than expanding
+         * them to RGBA.  Pair with palette() and ops::palette_view() to keep the image
+         * at one byte per pixel until the colors are needed.
+        */
+        Result<void> read_indices( const Image_Buffer& dest,
+                                   const math::Rect2i& bbox ) const;
+
+        /**
+         * Get the color palette, or null if the image is not paletted
+        */
+        Palette::ptr_t palette() const;
+
+        /**
+         * Read a single native tile with GDALRasterBand::ReadBlock(), bypassing
+         * GDAL's block cache.
+        */
+        Result<void> read_block( int                 ix,
+                                 int                 iy,
+                                 const Image_Buffer& dest ) const override;
+
         /**
          * Write the resource to disk
         */
@@ -116,6 +150,12 @@ class Image_Resource_Disk_GDAL : public Image_Resource_Disk
         */
         bool has_block_read() const override;
 
+        /**
+         * Reads are serialized on the master GDAL mutex internally, and the
+         * conversion runs outside of it.
+        */
+        bool has_concurrent_read() const override;
+
         /**
          * Block writes are supported by GDAL
         */
@@ -152,6 +192,17 @@ class Image_Resource_Disk_GDAL : public Image_Resource_Disk
         */
         double nodata_read() const override;
 
+        /**
+         * Check if a region falls entirely within sparse tiles, using GDAL's
+         * data coverage status.
+        */
+        bool is_empty( const math::Rect2i& bbox ) const override;
+
+        /**
+         * GDAL drivers with data coverage information can report empty regions
+        */
+        bool has_empty_regions() const override;
+
         /**
          * Set the nodata write value
         */
@@ -208,6 +259,9 @@ class Image_Resource_Disk_GDAL : public Image_Resource_Disk
 
         std::shared_ptr<GDAL_Disk_Image_Impl> m_impl;
 
+        /// Guards the one-time merge of the driver metadata
+        mutable std::once_flag m_metadata_merged;
+
         /// Color Code Lookup Table
         ColorCodeLookupT m_color_reference_lut;
 
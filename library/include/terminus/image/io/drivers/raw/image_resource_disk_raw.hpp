@@ -0,0 +1,260 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_resource_disk_raw.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/image/io/image_resource_disk.hpp>
+#include <terminus/image/types/image_buffer.hpp>
+
+// C++ Libraries
+#include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace tmns::image::io::raw {
+
+class ENVI_Header;
+class Uring_Reader;
+
+/**
+ * @class Image_Resource_Disk_Raw
+ *
+ * Disk Read/Write Interface for uncompressed rasters described by an ENVI ".hdr" sidecar.
+ *
+ * The data file is memory-mapped, so reads are page-cache hits and buffer() can hand out
+ * Image_Buffer views which point straight into the mapping without copying.
+ *
+ * Asynchronous batches bypass the mapping and go to the device through io_uring, so
+ * page faults do not stall the I/O threads and every tile of a batch is in flight at once.
+*/
+class Image_Resource_Disk_Raw : public Image_Resource_Disk
+{
+    public:
+
+        /// Parent Pointer Type
+        typedef Image_Resource_Disk::ptr_t ParentPtrT;
+
+        /**
+         * Hint to the kernel about how the mapping will be accessed
+        */
+        enum class Access_Pattern
+        {
+            NORMAL     = 0,
+            SEQUENTIAL = 1,
+            RANDOM     = 2,
+        }; // End of Access_Pattern enumeration
+
+        /**
+         * Parameterized Constructor for reading images.
+         * @param pathname Image to open
+        */
+        Image_Resource_Disk_Raw( const std::filesystem::path& pathname );
+
+        /**
+         * Parameterized Constructor for writing images.
+         * @param pathname Image to create
+        */
+        Image_Resource_Disk_Raw( const std::filesystem::path&             pathname,
+                                 const Image_Format&                      output_format,
+                                 const std::map<std::string,std::string>& write_options,
+                                 const math::Size2i&                      block_size );
+
+        /**
+         * Flushes and unmaps the file
+        */
+        ~Image_Resource_Disk_Raw() override;
+
+        /**
+         * Return the name of the resource
+        */
+        std::string resource_name() const override;
+
+        /**
+         * Create a new resource and map an existing image
+        */
+        static Result<ParentPtrT> create( const std::filesystem::path& pathname );
+
+        /**
+         * Create a new resource and map a new image for writing
+        */
+        static Result<ParentPtrT> create( const std::filesystem::path&             pathname,
+                                          const Image_Format&                      output_format,
+                                          const std::map<std::string,std::string>& write_options,
+                                          const math::Size2i&                      block_size );
+
+        /**
+         * Read the image data from the mapping
+        */
+        Result<void> read( const Image_Buffer& dest,
+                           const math::Rect2i& bbox ) const override;
+
+        using Read_Image_Resource_Base::read_async;
+
+        /**
+         * Queue a batch of reads.  The rows of every region are submitted to an io_uring
+         * together, so the device sees the whole batch at once.  Where io_uring is not
+         * available, readahead for every region is started before the reads are queued.
+        */
+        std::vector<std::future<Result<void>>> read_async( const std::vector<Image_Buffer>& dests,
+                                                           const std::vector<math::Rect2i>& bboxes ) const override;
+
+        /**
+         * Advise the kernel that a region is about to be read
+        */
+        void prefetch( const math::Rect2i& bbox ) const override;
+
+        /**
+         * Write the image data into the mapping
+        */
+        Result<void> write( const Image_Buffer& source,
+                            const math::Rect2i& bbox ) override;
+
+        /**
+         * Get a buffer pointing directly into the mapping for a region.  No data is
+         * copied.  The buffer is only valid while this resource is alive.
+        */
+        Result<Image_Buffer> buffer( const math::Rect2i& bbox ) const;
+
+        /**
+         * Tell the kernel how the mapping will be accessed
+        */
+        void set_access_pattern( Access_Pattern pattern );
+
+        /**
+         * Get the image format object
+        */
+        Image_Format format() const override;
+
+        /**
+         * Any region can be read directly from the mapping
+        */
+        bool has_block_read() const override;
+
+        /**
+         * Reads copy straight out of the mapping, so any number may run at once
+        */
+        bool has_concurrent_read() const override;
+
+        /**
+         * Any region can be written directly to the mapping
+        */
+        bool has_block_write() const override;
+
+        /**
+         * ENVI nodata values are not yet supported
+        */
+        bool has_nodata_read() const override;
+
+        /**
+         * ENVI nodata values are not yet supported
+        */
+        bool has_nodata_write() const override;
+
+        /**
+         * Get the block read size.  Full-width strips, since rows are contiguous.
+        */
+        math::Size2i block_read_size() const override;
+
+        /**
+         * Get the block write size
+        */
+        math::Size2i block_write_size() const override;
+
+        /**
+         * Set the block write size
+        */
+        void set_block_write_size( const math::Size2i& block_size ) override;
+
+        /**
+         * Get a pointer to the start of the mapped pixel data
+        */
+        std::shared_ptr<const uint8_t[]> native_ptr() const override;
+
+        /**
+         * Get the size of the mapped pixel data in bytes
+        */
+        size_t native_size() const override;
+
+        /**
+         * Sync the mapping to disk
+        */
+        void flush() override;
+
+        /**
+         * Print to log-friendly string
+        */
+        std::string to_log_string( size_t offset ) const override;
+
+    private:
+
+        /**
+         * Map the data file and build the strided layout from the header
+        */
+        Result<void> open( const ENVI_Header& header,
+                           bool               writable );
+
+        /**
+         * Get the io_uring reader, setting it up on first use.  Null if io_uring is unavailable.
+        */
+        std::shared_ptr<Uring_Reader> uring_reader() const;
+
+        /**
+         * Read a batch through io_uring and fulfill one promise per destination
+        */
+        void read_uring( Uring_Reader&                               reader,
+                         const std::vector<Image_Buffer>&            dests,
+                         const std::vector<math::Rect2i>&            bboxes,
+                         std::vector<std::promise<Result<void>>>&    promises ) const;
+
+        /// Format of the raster on disk
+        Image_Format m_format;
+
+        /// Mapped file.  Unmaps on release.
+        std::shared_ptr<uint8_t> m_mapping;
+
+        /// Size of the mapping in bytes
+        size_t m_mapping_size { 0 };
+
+        /// Start of the pixel data within the mapping
+        uint8_t* m_data { nullptr };
+
+        /// Offset of the pixel data within the file
+        size_t m_data_offset { 0 };
+
+        /// Data file, kept open for io_uring reads
+        int m_fd { -1 };
+
+        /// io_uring reader, set up by the first asynchronous batch.  Holds null if unavailable.
+        mutable std::mutex                                    m_uring_mutex;
+        mutable std::optional<std::shared_ptr<Uring_Reader>>  m_uring;
+
+        /// Strides, in bytes
+        size_t m_cstride { 0 };
+        size_t m_rstride { 0 };
+        size_t m_pstride { 0 };
+
+        /// Block write size
+        math::Size2i m_block_size;
+
+        /// True if the mapping is writable
+        bool m_writable { false };
+
+}; // End of Image_Resource_Disk_Raw class
+
+} // End of tmns::image::io::raw namespace
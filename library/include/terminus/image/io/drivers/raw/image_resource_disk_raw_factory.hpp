@@ -0,0 +1,71 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_resource_disk_raw_factory.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+/// Terminus Libraries
+#include <terminus/image/io/drivers/driver_factory_base.hpp>
+#include <terminus/image/io/drivers/raw/image_resource_disk_raw.hpp>
+
+// C++ Libraries
+#include <string>
+#include <vector>
+
+namespace tmns::image::io::raw {
+
+/**
+ * Exists purely to crank out memory-mapped raw Read/Write Resources.
+*/
+class Image_Resource_Disk_Raw_Factory : public Driver_Factory_Base
+{
+    public:
+
+        /// Disk Driver Pointer Type
+        typedef Image_Resource_Base::ptr_t DriverT;
+
+        Image_Resource_Disk_Raw_Factory() = default;
+
+        virtual ~Image_Resource_Disk_Raw_Factory() override = default;
+
+        /**
+         * Check if the image is a raw raster with an ENVI header
+        */
+        bool is_read_image_supported( const std::filesystem::path& pathname ) const override;
+
+        /**
+         * Check if the image type is supported for write operations
+        */
+        bool is_write_image_supported( const std::filesystem::path& pathname ) const override;
+
+        /**
+         * Create the raw Image Disk-Reader Resource
+        */
+        Result<DriverT> create_read_driver( const std::filesystem::path& pathname ) const override;
+
+        /**
+         * Create the raw Image Disk-Write Resource
+        */
+        Result<DriverT> create_write_driver( const std::filesystem::path&             pathname,
+                                             const Image_Format&                      output_format,
+                                             const std::map<std::string,std::string>& write_options,
+                                             const math::Size2i&                      block_size ) const override;
+
+    private:
+
+        /// List of supported extensions
+        std::vector<std::string> m_supported_extensions { ".img", ".raw", ".bil", ".bip", ".bsq" };
+
+}; // end of Image_Resource_Disk_Raw_Factory
+
+} // end of tmns::image::io::raw namespace
@@ -0,0 +1,149 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    resource_handle_cache.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+/// Terminus Libraries
+#include <terminus/image/io/image_resource_disk.hpp>
+
+// Boost Libraries
+#include <boost/utility.hpp>
+
+// C++ Libraries
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tmns::image::io {
+
+/**
+ * Bounded, thread-safe LRU of open read resources.
+ *
+ * Entries are keyed by absolute path, and are only returned while the file's
+ * modification time and size match the values seen when it was opened.  The
+ * budget limits how many handles the cache keeps open; resources still held
+ * by callers stay open after eviction until they are released.
+ *
+ * @note Cached resources are shared between every caller which opens the same
+ *       file, so settings such as set_rescale() apply to all of them.
+*/
+class Resource_Handle_Cache : boost::noncopyable
+{
+    public:
+
+        /// Pointer Type
+        typedef std::shared_ptr<Resource_Handle_Cache> ptr_t;
+
+        /// Cached Resource Type
+        typedef Image_Resource_Disk::ptr_t DriverT;
+
+        /**
+         * Constructor
+         *
+         * @param max_open Maximum number of resources kept open by the cache
+        */
+        Resource_Handle_Cache( size_t max_open = default_max_open() );
+
+        /**
+         * Get the process-wide cache shared by every Disk_Driver_Manager
+        */
+        static ptr_t instance();
+
+        /**
+         * Default open-file budget
+        */
+        static size_t default_max_open();
+
+        /**
+         * Find an open resource for the file
+         *
+         * @param pathname File to look up
+         * @param driver_keys Drivers the caller is allowed to use
+         *
+         * @return Cached resource, or nullptr if missing, stale, or opened by another driver
+        */
+        DriverT find( const std::filesystem::path&    pathname,
+                      const std::vector<std::string>& driver_keys );
+
+        /**
+         * Add a newly opened resource
+         *
+         * @return The cached resource.  If another thread cached the same file first,
+         *         its resource is returned instead.
+        */
+        DriverT insert( const std::filesystem::path& pathname,
+                        const std::string&           driver_key,
+                        DriverT                      resource );
+
+        /**
+         * Drop any resource cached for the file
+        */
+        void erase( const std::filesystem::path& pathname );
+
+        /**
+         * Drop every cached resource
+        */
+        void clear();
+
+        /**
+         * Get the number of cached resources
+        */
+        size_t size() const;
+
+        /**
+         * Get the open-file budget
+        */
+        size_t max_open() const;
+
+        /**
+         * Set the open-file budget, evicting as needed
+        */
+        void set_max_open( size_t max_open );
+
+    private:
+
+        /// Cached resource and the file state it was opened against
+        struct Entry
+        {
+            std::string                     key;
+            std::string                     driver_key;
+            std::filesystem::file_time_type mtime;
+            uintmax_t                       file_size;
+            DriverT                         resource;
+        }; // End of Entry struct
+
+        /**
+         * Drop least-recently-used entries over budget.  Must hold m_mutex.
+        */
+        void evict();
+
+        /// Lock for all state
+        mutable std::mutex m_mutex;
+
+        /// Entries, most-recently-used first
+        std::list<Entry> m_entries;
+
+        /// Lookup by absolute path
+        std::unordered_map<std::string,std::list<Entry>::iterator> m_index;
+
+        /// Open-file budget
+        size_t m_max_open;
+
+}; // End of Resource_Handle_Cache class
+
+} // End of tmns::image::io namespace
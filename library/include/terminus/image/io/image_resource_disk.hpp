@@ -62,6 +62,11 @@ class Image_Resource_Disk : public Image_Resource_Base,
          */
         static void set_default_rescale( bool rescale );
 
+        /**
+         * Fill a destination with the empty-region value, rescaled like reads
+        */
+        Result<void> read_fill( const Image_Buffer& dest ) const override;
+
         /**
          * Print to log-friendly string
         */
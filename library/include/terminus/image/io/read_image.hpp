@@ -87,22 +87,55 @@ Result<void> read_image( const Image_Memory<PixelT>&           dst,
                          const Read_Image_Resource_Base::ptr_t src,
                          const math::Rect2i&                   bbox )
 {
-    src->read( dst.buffer(), bbox );
-    return outcome::ok();
+    return src->read( dst.buffer(), bbox );
 }
 
 /**
- * Load an image into a generic image type container
+ * Load an image into a generic image type container.  The destination must already be
+ * sized to match the bounding box.
+ *
+ * Memory-backed destinations (see Is_Memory_Buffered), such as a crop of a larger
+ * Image_Memory or a single plane of one, are filled in place through their buffer strides.
+ * Other destinations are read through an intermediate buffer and rasterized.
 */
 template <typename ImageT>
 Result<void> read_image( const Image_Base<ImageT>&             dest,
                          const Read_Image_Resource_Base::ptr_t src,
                          const math::Rect2i&                   bbox )
 {
-    Image_Memory<typename ImageT::pixel_type> intermediate;
-    read_image( intermediate, src, bbox );
-    dest.impl() = intermediate;
-    return outcome::ok();
+    if( (int)dest.impl().cols() != bbox.width() ||
+        (int)dest.impl().rows() != bbox.height() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Destination size (", dest.impl().cols(), " x ", dest.impl().rows(),
+                              ") does not match read region ", bbox.to_string() );
+    }
+
+    if constexpr( Is_Memory_Buffered<ImageT>::value::value )
+    {
+        return src->read( dest.impl().buffer(), bbox );
+    }
+    else
+    {
+        Image_Memory<typename ImageT::pixel_type> intermediate;
+        auto size_res = intermediate.set_size( bbox.width(),
+                                               bbox.height(),
+                                               dest.impl().planes() );
+        if( size_res.has_error() )
+        {
+            return outcome::fail( size_res.error() );
+        }
+
+        auto read_res = src->read( intermediate.buffer(), bbox );
+        if( read_res.has_error() )
+        {
+            return outcome::fail( read_res.error() );
+        }
+
+        intermediate.rasterize( dest.impl(),
+                                math::Rect2i( 0, 0, bbox.width(), bbox.height() ) );
+        return outcome::ok();
+    }
 }
 
 /**
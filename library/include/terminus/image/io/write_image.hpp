@@ -21,9 +21,11 @@
 // Terminus Image Libraries
 #include "../operations/select_plane.hpp"
 #include "../types/Image_Memory.hpp"
+#include "block_write_queue.hpp"
 
 // C++ Libraries
 #include <sstream>
+#include <vector>
 
 // Boost Libraries
 #include <boost/algorithm/string.hpp>
@@ -43,33 +45,28 @@ Result<void> write_image( Write_Image_Resource_Base&  dst,
                           const Image_Memory<PixelT>& src,
                           const math::Rect2i&         bbox )
 {
-    dst.write( src.buffer(),
-               bbox );
-    return outcome::ok();
-}
-
-/**
- * Write the entire image to disk.
-*/
-template <class PixelT>
-Result<void> write_image( Image_Resource_Base::ptr_t   dst,
-                          const Image_Memory<PixelT>&  src )
-{
-    return write_image( dst,
-                        src,
-                        math::Rect2i( 0, 0, src.cols(), src.rows() ) );
+    return dst.write( src.buffer(),
+                      bbox );
 }
 
 /**
- * Write an image to disk
+ * Write an image to disk for a ROI.  Memory-backed images are written
+ * without an intermediate copy.
 */
 template <class ImageT>
 Result<void> write_image( Image_Resource_Base::ptr_t dst,
                           const Image_Base<ImageT>&  src,
                           const math::Rect2i&        bbox )
 {
-    Image_Memory<typename ImageT::pixel_type> intermediate = src;
-    return write_image( dst, intermediate, bbox );
+    if constexpr( Is_Memory_Buffered<ImageT>::value::value )
+    {
+        return dst->write( src.impl().buffer(), bbox );
+    }
+    else
+    {
+        Image_Memory<typename ImageT::pixel_type> intermediate = src.impl();
+        return write_image( *dst, intermediate, bbox );
+    }
 }
 
   /**
@@ -108,13 +105,56 @@ Result<void> write_image( Image_Resource_Base::ptr_t dst,
     return outcome::ok();
 }
 
+/**
+ * Write a buffer which already lives in memory to a resource, one block at a time.
+ * Each block is passed as a strided sub-view of @p buffer, so no pixels are copied.
+*/
+inline Result<void> write_buffer_blocks( Image_Resource_Base::ptr_t         resource,
+                                         const Image_Buffer&                buffer,
+                                         const math::Size2i&                block_size,
+                                         core::utility::Progress_Callback&  progress_callback )
+{
+    const int rows = buffer.rows();
+    const int cols = buffer.cols();
+    const size_t total_num_blocks = ( ( rows - 1 ) / block_size.height() + 1 )
+                                  * ( ( cols - 1 ) / block_size.width()  + 1 );
+
+    size_t block_index = 0;
+    for( int j = 0; j < rows; j+= block_size.height() ) {
+    for( int i = 0; i < cols; i+= block_size.width()  ) {
+
+        math::Rect2i current_bbox( math::ToPoint2<int>( i, j ),
+                                   math::ToPoint2<int>( std::min( i + block_size.width(),  cols ),
+                                                        std::min( j + block_size.height(), rows ) ) );
+
+        auto res = resource->write( buffer.cropped( current_bbox ), current_bbox );
+        if( res.has_error() )
+        {
+            return outcome::fail( res.error() );
+        }
+
+        progress_callback.report_progress( float( ++block_index ) / static_cast<float>( total_num_blocks ) );
+        if( progress_callback.abort_requested() )
+        {
+            return outcome::fail( core::error::ErrorCode::ABORTED,
+                                  "Aborted by ProgressCallback" );
+        }
+    }}
+    return outcome::ok();
+}
+
 /**
  * Write an image to disk
+ *
+ * Memory-backed images (see Is_Memory_Buffered) are written directly from their pixels.
+ * Otherwise, blocks are rasterized in parallel using @p num_threads workers and committed to the
+ * resource in order by the calling thread.  Set @p num_threads to 1 to rasterize serially.
 */
 template <class ImageT>
 Result<void> write_image( Image_Resource_Base::ptr_t         resource,
                           const Image_Base<ImageT>&          image,
-                          core::utility::Progress_Callback&  progress_callback = core::utility::Progress_Callback::dummy_instance() )
+                          core::utility::Progress_Callback&  progress_callback = core::utility::Progress_Callback::dummy_instance(),
+                          size_t                             num_threads = default_block_write_threads() )
 {
     // Check empty resource
     if( image.impl().cols() == 0 ||
@@ -139,9 +179,8 @@ Result<void> write_image( Image_Resource_Base::ptr_t         resource,
     const int rows = image.impl().rows();
     const int cols = image.impl().cols();
 
-    // Write the image to disk in blocks.  We may need to revisit
-    // the order in which these blocks are rasterized, but for now
-    // it rasterizes blocks from left to right, then top to bottom.
+    // Write the image to disk in blocks.  Blocks are committed from left to right,
+    // then top to bottom, regardless of the order in which they are rasterized.
     math::Size2i block_size( { cols, rows } );
     if( resource->has_block_write() )
     {
@@ -153,43 +192,46 @@ Result<void> write_image( Image_Resource_Base::ptr_t         resource,
 
     tmns::log::debug( "writing ", total_num_blocks, " blocks." );
 
+    // Pixels are already in memory, so hand them straight to the resource
+    if constexpr( Is_Memory_Buffered<ImageT>::value::value )
+    {
+        auto res = write_buffer_blocks( resource,
+                                        image.impl().buffer(),
+                                        block_size,
+                                        progress_callback );
+        if( res.has_error() )
+        {
+            tmns::log::error( res.error().message() );
+            return outcome::fail( res.error() );
+        }
+    }
+
     // Early out for easy case
-    if( total_num_blocks == 1 )
+    else if( total_num_blocks == 1 )
     {
         Image_Memory<typename ImageT::pixel_type> image_block = image.impl();
-        resource->write( image_block.buffer(),
-                         math::Rect2i( 0,
-                                       0,
-                                       image_block.cols(),
-                                       image_block.rows() ) );
+        auto res = resource->write( image_block.buffer(),
+                                    math::Rect2i( 0,
+                                                  0,
+                                                  image_block.cols(),
+                                                  image_block.rows() ) );
+        if( res.has_error() )
+        {
+            return outcome::fail( res.error() );
+        }
     }
     else
     {
-        for( int j = 0; j < rows; j+= block_size.height() ) {
-        for( int i = 0; i < cols; i+= block_size.width()  ) {
-
-            tmns::log::trace( "writing block at [", i, ", ", j, "]/[", rows, ", ",
-                              cols, "] blocksize = ", block_size.width(), " x ",
-                              block_size.height() );
-
-            // Rasterize and save this image block
-            math::Rect2i current_bbox( math::Point2_<int>( { i, j } ),
-                                       math::Point2_<int>( { std::min<int>( i + block_size.width(),
-                                                                            cols ),
-                                                             std::min<int>( j + block_size.height(),
-                                                                            rows ) } ) );
-
-            float processed_row_blocks = float( j / block_size.height() * ( ( cols - 1 ) / block_size.width() + 1 ) );
-            float processed_col_blocks = float( i / block_size.width() );
-            progress_callback.report_progress( ( processed_row_blocks + processed_col_blocks ) / static_cast<float>( total_num_blocks ) );
-
-            // Rasterize this image block
-            Image_Memory<typename ImageT::pixel_type> image_block( crop_image( image.impl(),
-                                                                               current_bbox ) );
-
-            Image_Buffer buf = image_block.buffer();
-            resource->write( buf, current_bbox );
-        }}
+        Block_Write_Queue<ImageT> write_queue( resource,
+                                               image.impl(),
+                                               block_size,
+                                               std::min( num_threads, total_num_blocks ) );
+        auto res = write_queue( progress_callback );
+        if( res.has_error() )
+        {
+            tmns::log::error( res.error().message() );
+            return outcome::fail( res.error() );
+        }
     }
     progress_callback.report_finished();
 
@@ -281,13 +323,17 @@ Result<void> write_image_block( Image_Resource_Base::ptr_t         resource,
 /**
  * Write any image type to disk.  If you supply a filename with an asterisk ('*'), each plane
  * of the image will be saved as a seperate file with the asterisk replaced with the plane number.
+ *
+ * Per-plane files are produced in a single pass:  each block of the source is rasterized once,
+ * using @p num_threads workers, then split across all of the plane resources.
  */
 template <class ImageT>
 Result<void> write_image( const std::filesystem::path&             pathname,
                           const Image_Base<ImageT>&                out_image,
                           const std::map<std::string,std::string>& write_options = std::map<std::string,std::string>(),
                           const Disk_Driver_Manager::ptr_t         driver_manager = Disk_Driver_Manager::create_write_defaults(),
-                          core::utility::Progress_Callback&        progress_callback = core::utility::Progress_Callback::dummy_instance() )
+                          core::utility::Progress_Callback&        progress_callback = core::utility::Progress_Callback::dummy_instance(),
+                          size_t                                   num_threads = default_block_write_threads() )
 {
     tmns::log::trace( ADD_CURRENT_LOC(), "Start of Method" );
     Image_Format out_image_format = out_image.format();
@@ -300,6 +346,8 @@ Result<void> write_image( const std::filesystem::path&             pathname,
         out_image_format.set_planes( 1 );
     }
 
+    // Create an image resource for each output file
+    std::vector<Image_Resource_Base::ptr_t> resources;
     for( unsigned p=0; p<files; ++p )
     {
         std::string name = pathname.native();
@@ -315,10 +363,9 @@ Result<void> write_image( const std::filesystem::path&             pathname,
             tmns::log::info( sout.str() );
         }
 
-        // Create an image resource for the data
         math::Size2i block_size( { -1, -1 } ); // Basically ignore
         tmns::log::trace( ADD_CURRENT_LOC(), "Picking Write Driver" );
-        auto driver_res = driver_manager->pick_write_driver( pathname,
+        auto driver_res = driver_manager->pick_write_driver( name,
                                                              out_image_format,
                                                              write_options,
                                                              block_size );
@@ -326,40 +373,58 @@ Result<void> write_image( const std::filesystem::path&             pathname,
         {
             return outcome::fail( driver_res.assume_error() );
         }
-        auto resource = driver_res.assume_value();
-
-
-        if ( files > 1 )
-        {
-            auto selected_channel = ops::select_plane( out_image.impl(), p );
-
-            auto res = write_image( resource,
-                                    selected_channel,
-                                    progress_callback );
+        resources.push_back( driver_res.assume_value() );
+    }
 
-            progress_callback.report_finished();
-            if( res.has_error() )
-            {
-                tmns::log::error( res.error().message() );
-                return outcome::fail( res.error() );
-            }
-        }
-        else
+    // Single file, or planes which are already in memory and cheap to select
+    if( files == 1 || Is_Memory_Buffered<ImageT>::value::value )
+    {
+        for( unsigned p=0; p<files; ++p )
         {
             core::utility::Subtask_Progress_Callback sub_progress_callback( progress_callback,
                                                                             float(p) / float(files),
                                                                             float(p+1) / float(files) );
-            auto res = write_image( resource,
-                                    ops::select_plane( out_image.impl(), p ),
-                                    sub_progress_callback );
-
+            auto res = ( files == 1 ) ? write_image( resources[p],
+                                                     out_image.impl(),
+                                                     sub_progress_callback,
+                                                     num_threads )
+                                      : write_image( resources[p],
+                                                     ops::select_plane( out_image.impl(), p ),
+                                                     sub_progress_callback,
+                                                     num_threads );
             if( res.has_error() )
             {
                 tmns::log::error( res.error().message() );
                 return outcome::fail( res.error() );
             }
         }
+        progress_callback.report_finished();
+        return outcome::ok();
     }
+
+    // Rasterize each block once and split it across the per-plane resources
+    progress_callback.report_progress( 0 );
+    math::Size2i block_size( { (int)out_image.impl().cols(), (int)out_image.impl().rows() } );
+    if( resources.front()->has_block_write() )
+    {
+        block_size = resources.front()->block_write_size();
+    }
+
+    const size_t total_num_blocks = ( ( out_image.impl().cols() - 1 ) / block_size.width()  + 1 ) *
+                                    ( ( out_image.impl().rows() - 1 ) / block_size.height() + 1 );
+    Block_Write_Queue<ImageT> write_queue( std::vector<Write_Image_Resource_Base::ptr_t>( resources.begin(),
+                                                                                          resources.end() ),
+                                           out_image.impl(),
+                                           block_size,
+                                           std::min( num_threads, total_num_blocks ) );
+    auto res = write_queue( progress_callback );
+    if( res.has_error() )
+    {
+        tmns::log::error( res.error().message() );
+        return outcome::fail( res.error() );
+    }
+    progress_callback.report_finished();
+
     return outcome::ok();
 }
 
@@ -15,6 +15,7 @@
 #pragma once
 
 // Terminus Image Libraries
+#include "../../types/Image_Traits.hpp"
 #include "Block_Generator.hpp"
 
 // External Terminus Libraries
@@ -29,12 +30,21 @@ namespace tmns::image::ops::block {
 /**
  * Creates and manages blocks of data spanning the image.
  * Handles the cache API work.
+ *
+ * If the image can report empty regions (see Has_Empty_Regions), empty blocks
+ * are not given a generator.  They all share a single constant fill block instead.
 */
 template <typename ImageT>
 class Block_Generator_Manager
 {
     public:
 
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Shared block returned for every empty block
+        typedef std::shared_ptr<const Image_Memory<pixel_type>> fill_block_type;
+
         /**
          * Default Constructor
         */
@@ -68,6 +78,8 @@ class Block_Generator_Manager
             m_table_width  = (image->cols()-1) / m_block_size.width() + 1;
             m_table_height = (image->rows()-1) / m_block_size.height() + 1;
             m_block_table.resize( m_table_height * m_table_width );
+            m_empty_blocks.assign( m_table_height * m_table_width, false );
+            m_fill_block.reset();
             auto view_bbox = image->full_bbox();
 
             // Iterate through the block positions and insert a generator object for each block
@@ -80,6 +92,18 @@ class Block_Generator_Manager
                                    m_block_size.height() );
 
                 bbox = math::Rect2i::intersection( bbox, view_bbox );
+                if constexpr( Has_Empty_Regions<ImageT>::value::value )
+                {
+                    if( image->has_empty_regions() && image->is_empty( bbox ) )
+                    {
+                        m_empty_blocks[ix + iy * m_table_width] = true;
+                        if( !m_fill_block )
+                        {
+                            m_fill_block = create_fill_block( image->fill_pixel(), image->planes() );
+                        }
+                        continue;
+                    }
+                }
                 block(ix,iy) = m_cache_ptr->insert( Block_Generator<ImageT>( image, bbox ) );
             }} // End loop through the blocks
 
@@ -155,6 +179,25 @@ class Block_Generator_Manager
             return m_block_table[ ix + iy * m_table_width ];
         }
 
+        /**
+         * Check if a block holds no data.  Empty blocks have no generator, so read
+         * them from fill_block() instead.
+        */
+        bool is_empty_block( const math::Point2i& block_index ) const
+        {
+            check_block_index( block_index );
+            return m_empty_blocks[block_index.x() + block_index.y()*m_table_width];
+        }
+
+        /**
+         * Get the block shared by every empty block.  It is the size of a full block,
+         * so crop it to the block's bounding box.  Null if no block is empty.
+        */
+        const fill_block_type& fill_block() const
+        {
+            return m_fill_block;
+        }
+
         /**
          * Return true if there is only a single block
         */
@@ -174,6 +217,23 @@ class Block_Generator_Manager
 
     private:
 
+        /**
+         * Build the constant block shared by every empty block
+        */
+        fill_block_type create_fill_block( const pixel_type& fill,
+                                           size_t            planes ) const
+        {
+            auto result = std::make_shared<Image_Memory<pixel_type>>( m_block_size.width(),
+                                                                      m_block_size.height(),
+                                                                      planes );
+            for( size_t p = 0; p < planes; ++p ) {
+            for( int y = 0; y < m_block_size.height(); ++y ) {
+            for( int x = 0; x < m_block_size.width();  ++x ) {
+                (*result)( x, y, p ) = fill;
+            }}}
+            return result;
+        }
+
         /// Cache Handle
         core::cache::Cache_Local::ptr_t m_cache_ptr;
 
@@ -189,6 +249,12 @@ class Block_Generator_Manager
         /// Block Table
         std::vector<core::cache::Cache_Local::Handle<Block_Generator<ImageT>>> m_block_table;
 
+        /// Blocks which hold no data, and so have no generator
+        std::vector<bool> m_empty_blocks;
+
+        /// Constant block shared by all empty blocks
+        fill_block_type m_fill_block;
+
 }; // End of Block_Generator_Manager class
 
 } // End of tmns::image::ops::block namespace
\ No newline at end of file
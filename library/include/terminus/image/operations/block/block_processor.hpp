@@ -20,8 +20,22 @@
 // Terminus Image Libraries
 #include <terminus/image/utility/Log_Utilities.hpp>
 
+// C++ Libraries
+#include <type_traits>
+#include <vector>
+
 namespace tmns::image::ops::block {
 
+/**
+ * Check if a block function can be told which blocks are coming, with a
+ * prefetch(Rect2i) method.
+*/
+template <typename FuncT>
+struct Has_Prefetch
+{
+    typedef std::bool_constant<requires( const FuncT& func, const math::Rect2i& bbox ){ func.prefetch( bbox ); }> value;
+}; // End of Has_Prefetch struct
+
 /**
  * Major block processing routing.  Creates and dispatches all threads
 */
@@ -35,13 +49,17 @@ class Block_Processor
          * - The function will get executed in "units" of block_size simultaneously
          *   by the specified number of threads.
          * - The func object must have an operator(BBox2i) function that does whatever
+         * - If the func object has a prefetch(BBox2i) method, it is called for up to
+         *   read_ahead blocks beyond the ones being processed, so their reads can start early.
         */
         Block_Processor( const FuncT&        func,
                          const math::Size2i& block_size,
-                         size_t              threads = std::max( (int)std::thread::hardware_concurrency() / 4, 2 ) )
+                         size_t              threads = std::max( (int)std::thread::hardware_concurrency() / 4, 2 ),
+                         size_t              read_ahead = 0 )
           : m_func(func),
             m_block_size(block_size),
-            m_num_threads( threads ) {}
+            m_num_threads( threads ),
+            m_read_ahead( read_ahead ) {}
 
         /// We will construct and call one BlockThread per thread.
         class Block_Thread
@@ -56,7 +74,8 @@ class Block_Processor
 
                         Info( const FuncT&         func,
                               const math::Rect2i&  total_bbox,
-                              const math::Size2i&  block_size )
+                              const math::Size2i&  block_size,
+                              size_t               read_ahead = 0 )
                             : m_func(func),
                               m_total_bbox(total_bbox),
                               m_block_bbox( round_down( total_bbox.min().x(),
@@ -65,7 +84,9 @@ class Block_Processor
                                                         block_size.height() ),
                                             block_size.width(),
                                             block_size.height() ),
-                              m_block_size(block_size) {}
+                              m_prefetch_bbox( m_block_bbox ),
+                              m_block_size(block_size),
+                              m_read_ahead( read_ahead ) {}
 
 
                         // Return the next block bbox to process.
@@ -97,21 +118,48 @@ class Block_Processor
                         // Advance the block_bbox to point to the next block to process.
                         void advance()
                         {
-                            m_block_bbox.min().x() += m_block_size.width();
+                            advance( m_block_bbox );
+                            ++m_blocks_taken;
+                        }
 
-                            if( m_block_bbox.min().x() >= m_total_bbox.max().x() )
+                        // Collect the blocks to prefetch, staying read_ahead blocks past the
+                        // last block taken.  Each block is only handed out once.
+                        void next_prefetch( std::vector<math::Rect2i>& bboxes )
+                        {
+                            // Blocks already taken no longer need a hint
+                            while( m_blocks_prefetched < m_blocks_taken )
                             {
-                                m_block_bbox.min().x() = round_down( m_total_bbox.min().x(),
-                                                                     m_block_size.width() );
-                                m_block_bbox.min().y() += m_block_size.height();
-
-                                m_block_bbox.height() = m_block_size.height();
+                                advance( m_prefetch_bbox );
+                                ++m_blocks_prefetched;
+                            }
+                            while( m_blocks_prefetched < m_blocks_taken + m_read_ahead &&
+                                   m_prefetch_bbox.min().y() < m_total_bbox.max().y() )
+                            {
+                                bboxes.push_back( math::Rect2i::intersection( m_prefetch_bbox,
+                                                                              m_total_bbox ) );
+                                advance( m_prefetch_bbox );
+                                ++m_blocks_prefetched;
                             }
-                            m_block_bbox.width() = m_block_size.width();
                         }
 
                     private:
 
+                        // Step a block bbox to the next block, in row-major order.
+                        void advance( math::Rect2i& block_bbox ) const
+                        {
+                            block_bbox.min().x() += m_block_size.width();
+
+                            if( block_bbox.min().x() >= m_total_bbox.max().x() )
+                            {
+                                block_bbox.min().x() = round_down( m_total_bbox.min().x(),
+                                                                   m_block_size.width() );
+                                block_bbox.min().y() += m_block_size.height();
+
+                                block_bbox.height() = m_block_size.height();
+                            }
+                            block_bbox.width() = m_block_size.width();
+                        }
+
                         // This hideous nonsense rounds an integer value *down* to the nearest
                         // multple of the given modulus.  It's this hideous partly because
                         // it avoids modular arithematic on negative numbers, which is technically
@@ -124,7 +172,11 @@ class Block_Processor
                         const FuncT&       m_func;
                         math::Rect2i       m_total_bbox;
                         math::Rect2i       m_block_bbox;
+                        math::Rect2i       m_prefetch_bbox;
                         math::Size2i       m_block_size;
+                        size_t             m_read_ahead { 0 };
+                        size_t             m_blocks_taken { 0 };
+                        size_t             m_blocks_prefetched { 0 };
                         core::conc::Mutex  m_mutex;
                 }; // End class Info
 
@@ -132,6 +184,7 @@ class Block_Processor
 
                 void operator()()
                 {
+                    std::vector<math::Rect2i> upcoming;
                     while( true )
                     {
                         math::Rect2i bbox;
@@ -145,6 +198,20 @@ class Block_Processor
                             }
                             bbox = info.bbox();
                             info.advance();
+                            if constexpr ( Has_Prefetch<FuncT>::value::value )
+                            {
+                                info.next_prefetch( upcoming );
+                            }
+                        }
+
+                        // Start reading the blocks behind this one before working on it
+                        if constexpr ( Has_Prefetch<FuncT>::value::value )
+                        {
+                            for( const auto& next_bbox : upcoming )
+                            {
+                                info.func().prefetch( next_bbox );
+                            }
+                            upcoming.clear();
                         }
                         info.func()( bbox );
                     }
@@ -160,7 +227,7 @@ class Block_Processor
         */
         void operator()( math::Rect2i bbox ) const
         {
-            typename Block_Thread::Info info( m_func, bbox, m_block_size );
+            typename Block_Thread::Info info( m_func, bbox, m_block_size, m_read_ahead );
 
             // Avoid threads altogether in the single-threaded case.
             // Annoyingly, this still creates an unnecessary Mutex.
@@ -211,6 +278,9 @@ class Block_Processor
         /// @brief Number of threads to generate
         int   m_num_threads;
 
+        /// @brief Number of blocks to prefetch ahead of the workers
+        size_t m_read_ahead { 0 };
+
 }; // End class Block_Processor
 
 } // End of tmns::image::ops::block namespace
\ No newline at end of file
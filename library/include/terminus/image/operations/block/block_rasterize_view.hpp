@@ -119,7 +119,7 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
             {
                 // Note that requesting a value from a handle forces that data to be generated.
                 // Early-out optimization for single-block resources
-                if( m_block_manager.only_one_block() )
+                if( m_block_manager.only_one_block() && !m_block_manager.fill_block() )
                 {
                     const auto& handle = m_block_manager.quick_single_block();
                     result_type result = handle->operator()( x, y, p );
@@ -129,6 +129,10 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
 
                 // Otherwise, figure out first what block to fetch
                 auto block_index   = m_block_manager.get_block_index( tmns::math::Point2i( { (int)x, (int)y } ) );
+                if( m_block_manager.is_empty_block( block_index ) )
+                {
+                    return (*m_block_manager.fill_block())( 0, 0, p );
+                }
                 const auto& handle = m_block_manager.block( block_index );
 
                 auto start_pixel = m_block_manager.get_block_start_pixel( block_index );
@@ -148,6 +152,38 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
             }
         }
 
+        /**
+         * Check if the child can report regions holding no data
+        */
+        bool has_empty_regions() const requires ( Has_Empty_Regions<ImageT>::value::value )
+        {
+            return m_child->has_empty_regions();
+        }
+
+        /**
+         * Check if the child reports the region as holding no data
+        */
+        bool is_empty( const math::Rect2i& bbox ) const requires ( Has_Empty_Regions<ImageT>::value::value )
+        {
+            return m_child->is_empty( bbox );
+        }
+
+        /**
+         * Value of every pixel in an empty region
+        */
+        pixel_type fill_pixel() const requires ( Has_Empty_Regions<ImageT>::value::value )
+        {
+            return m_child->fill_pixel();
+        }
+
+        /**
+         * Get the block size used for processing
+        */
+        math::Size2i block_size() const
+        {
+            return m_block_size;
+        }
+
         /**
          * Get the Child Class
         */
@@ -180,10 +216,12 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
             // Create functor to rasterize this image into the destination image
             Rasterize_Functor<DestT> rasterizer( *this, dest, bbox.min() );
 
-            // Set up block processor to call the functor in parallel blocks.
+            // Set up block processor to call the functor in parallel blocks.  Children
+            // that take prefetch hints get one block per thread ahead of the workers.
             block::Block_Processor<Rasterize_Functor<DestT> > process( rasterizer,
                                                                        m_block_size,
-                                                                       m_num_threads );
+                                                                       m_num_threads,
+                                                                       std::max( m_num_threads, 1 ) );
 
             // Tell the block processor to do all the work.
             process( bbox );
@@ -239,6 +277,15 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
                         // we might already have it.
                         auto block_index = m_image.m_block_manager.get_block_index( bbox );
 
+                        // Empty blocks all read from the same constant block
+                        if( m_image.m_block_manager.is_empty_block( block_index ) )
+                        {
+                            m_image.m_block_manager.fill_block()->rasterize( crop_image( m_dest,
+                                                                                         bbox - m_offset ),
+                                                                             bbox - m_image.m_block_manager.get_block_start_pixel( block_index ) );
+                            return;
+                        }
+
                         // Handle Type: core::cache::Cache_Local::Handle<Block_Generator<ImageT> >
                         const auto& handle = m_image.m_block_manager.block( block_index );
                         auto new_bbox = bbox - m_offset;
@@ -255,6 +302,15 @@ class Block_Rasterize_View : public Image_Base<Block_Rasterize_View<ImageT>>
                     }
                 }
 
+                /**
+                 * Pass a hint about an upcoming block on to the child
+                 */
+                void prefetch( const math::Rect2i& bbox ) const
+                    requires block::Has_Prefetch<ImageT>::value::value
+                {
+                    m_image.child().prefetch( bbox );
+                }
+
                 /**
                  * Get this class name
                  */
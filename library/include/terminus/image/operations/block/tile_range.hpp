@@ -0,0 +1,455 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    tile_range.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// Terminus Libraries
+#include <terminus/core/work/Thread.hpp>
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
+
+// Terminus Image Libraries
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_resource_view.hpp>
+
+namespace tmns::image {
+namespace ops::block {
+
+/// Tile size used for resources without a native block size, so memory stays bounded
+static constexpr int DEFAULT_RESOURCE_TILE_SIZE = 256;
+
+/**
+ * A single tile produced by a Tile_Range.  The pixel buffer is owned by the range
+ * and reused for later tiles, so it is only valid until the iterator advances.
+*/
+template <typename PixelT>
+class Tile
+{
+    public:
+
+        /**
+         * Get the tile pixels.  Covers halo_bbox(), so the core region starts
+         * at ( bbox().min() - halo_bbox().min() ).
+        */
+        const Image_Memory<PixelT>& image() const { return m_image; }
+
+        /**
+         * Get the tile pixels
+        */
+        Image_Memory<PixelT>& image() { return m_image; }
+
+        /**
+         * Get the core tile region, in source image coordinates
+        */
+        const math::Rect2i& bbox() const { return m_bbox; }
+
+        /**
+         * Get the region covered by image(), in source image coordinates.  This is
+         * bbox() expanded by the halo and clipped to the source image.
+        */
+        const math::Rect2i& halo_bbox() const { return m_halo_bbox; }
+
+        /**
+         * Get the tile index, in row-major order
+        */
+        size_t index() const { return m_index; }
+
+    private:
+
+        template <typename ImageT> friend class Tile_Range;
+
+        /// Tile Pixels
+        Image_Memory<PixelT> m_image;
+
+        /// Core Region
+        math::Rect2i m_bbox;
+
+        /// Region covered by the pixels
+        math::Rect2i m_halo_bbox;
+
+        /// Tile Index
+        size_t m_index { 0 };
+
+}; // End of Tile class
+
+/**
+ * Single-pass range over the tiles of an image, for out-of-core processing.
+ *
+ * Tiles are rasterized ahead of the consumer by one or more background threads into
+ * a fixed ring of reused buffers, so memory use is bounded by (read_ahead * tile size)
+ * regardless of the image size.  Tiles are always visited left-to-right, top-to-bottom.
+ *
+ * Exceptions thrown while rasterizing are rethrown to the consumer when it reaches
+ * the failed tile.
+*/
+template <typename ImageT>
+class Tile_Range
+{
+    public:
+
+        /// Pixel Type
+        typedef typename ImageT::pixel_type pixel_type;
+
+        /// Tile Type
+        typedef Tile<pixel_type> tile_type;
+
+        /**
+         * Input iterator over the tiles
+        */
+        class iterator
+        {
+            public:
+
+                typedef std::input_iterator_tag iterator_category;
+                typedef tile_type               value_type;
+                typedef std::ptrdiff_t          difference_type;
+                typedef tile_type*              pointer;
+                typedef tile_type&              reference;
+
+                iterator() = default;
+
+                iterator( Tile_Range* range, size_t index )
+                  : m_range( range ),
+                    m_index( index ) {}
+
+                reference operator*() const
+                {
+                    return m_range->acquire( m_index );
+                }
+
+                pointer operator->() const
+                {
+                    return &m_range->acquire( m_index );
+                }
+
+                iterator& operator++()
+                {
+                    m_range->release( m_index );
+                    ++m_index;
+                    return *this;
+                }
+
+                void operator++(int)
+                {
+                    ++(*this);
+                }
+
+                bool operator == ( const iterator& rhs ) const
+                {
+                    return m_index == rhs.m_index;
+                }
+
+            private:
+
+                Tile_Range* m_range { nullptr };
+
+                size_t m_index { 0 };
+
+        }; // End of iterator class
+
+        /**
+         * Constructor
+         *
+         * @param image Source image
+         * @param tile_size Size of each tile, not including the halo
+         * @param halo Number of extra pixels to read around each side of a tile
+         * @param num_threads Number of background rasterization threads
+         * @param read_ahead Number of tile buffers.  Zero picks one more than the thread count.
+        */
+        Tile_Range( const ImageT&       image,
+                    const math::Size2i& tile_size,
+                    int                 halo        = 0,
+                    size_t              num_threads = 1,
+                    size_t              read_ahead  = 0 )
+          : Tile_Range( std::make_shared<const ImageT>( image ),
+                        tile_size,
+                        halo,
+                        num_threads,
+                        read_ahead ) {}
+
+        /**
+         * Constructor for a shared source image, such as a non-copyable resource view
+        */
+        Tile_Range( std::shared_ptr<const ImageT> image,
+                    const math::Size2i&           tile_size,
+                    int                           halo        = 0,
+                    size_t                        num_threads = 1,
+                    size_t                        read_ahead  = 0 )
+          : m_image( image ),
+            m_num_threads( std::max<size_t>( num_threads, 1 ) )
+        {
+            const int rows = m_image->rows();
+            const int cols = m_image->cols();
+            const auto full_bbox = math::Rect2i( 0, 0, cols, rows );
+            for( int j = 0; j < rows; j += tile_size.height() ) {
+            for( int i = 0; i < cols; i += tile_size.width()  ) {
+                math::Rect2i bbox( i, j,
+                                   std::min( tile_size.width(),  cols - i ),
+                                   std::min( tile_size.height(), rows - j ) );
+                math::Rect2i halo_bbox( bbox.min().x() - halo,
+                                        bbox.min().y() - halo,
+                                        bbox.width()  + 2 * halo,
+                                        bbox.height() + 2 * halo );
+                m_bboxes.push_back( bbox );
+                m_halo_bboxes.push_back( math::Rect2i::intersection( halo_bbox, full_bbox ) );
+            }}
+
+            const size_t depth = ( read_ahead > 0 ) ? read_ahead : m_num_threads + 1;
+            m_slots.resize( std::max<size_t>( depth, 1 ) );
+            m_ready.resize( m_bboxes.size(), false );
+            m_errors.resize( m_bboxes.size() );
+        }
+
+        Tile_Range( const Tile_Range& ) = delete;
+        Tile_Range& operator = ( const Tile_Range& ) = delete;
+
+        /**
+         * Destructor.  Stops and joins any background threads.
+        */
+        ~Tile_Range()
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_stop = true;
+            }
+            m_cond.notify_all();
+            for( auto& thread : m_threads )
+            {
+                thread->join();
+            }
+        }
+
+        /**
+         * Start reading and get the first tile.  A range can only be traversed once.
+        */
+        iterator begin()
+        {
+            if( m_threads.empty() )
+            {
+                for( size_t i = 0; i < std::min( m_num_threads, m_bboxes.size() ); ++i )
+                {
+                    auto worker = std::make_shared<Read_Thread>( *this );
+                    m_workers.push_back( worker );
+                    m_threads.push_back( std::make_shared<core::work::Thread>( worker ) );
+                }
+            }
+            return iterator( this, 0 );
+        }
+
+        /**
+         * Get the end iterator
+        */
+        iterator end()
+        {
+            return iterator( this, m_bboxes.size() );
+        }
+
+        /**
+         * Get the number of tiles
+        */
+        size_t size() const
+        {
+            return m_bboxes.size();
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Tile_Range";
+        }
+
+    private:
+
+        /**
+         * Background worker which rasterizes tiles into free slots
+        */
+        class Read_Thread
+        {
+            public:
+
+                Read_Thread( Tile_Range& range ) : m_range( range ) {}
+
+                void operator()()
+                {
+                    while( true )
+                    {
+                        size_t index;
+                        {
+                            std::unique_lock<std::mutex> lock( m_range.m_mutex );
+                            m_range.m_cond.wait( lock, [this]{ return m_range.m_stop ||
+                                                                      m_range.m_next_tile >= m_range.m_bboxes.size() ||
+                                                                      m_range.m_next_tile < m_range.m_released + m_range.m_slots.size(); } );
+                            if( m_range.m_stop || m_range.m_next_tile >= m_range.m_bboxes.size() )
+                            {
+                                return;
+                            }
+                            index = m_range.m_next_tile++;
+                        }
+
+                        // The slot is ours until the consumer releases this tile
+                        auto& tile = m_range.m_slots[index % m_range.m_slots.size()];
+                        tile.m_index     = index;
+                        tile.m_bbox      = m_range.m_bboxes[index];
+                        tile.m_halo_bbox = m_range.m_halo_bboxes[index];
+                        try
+                        {
+                            auto res = tile.m_image.set_size( tile.m_halo_bbox.width(),
+                                                              tile.m_halo_bbox.height(),
+                                                              m_range.m_image->planes() );
+                            if( res.has_error() )
+                            {
+                                throw std::runtime_error( res.error().message() );
+                            }
+                            m_range.m_image->rasterize( tile.m_image, tile.m_halo_bbox );
+                        }
+                        catch( ... )
+                        {
+                            std::unique_lock<std::mutex> lock( m_range.m_mutex );
+                            m_range.m_errors[index] = std::current_exception();
+                        }
+
+                        {
+                            std::unique_lock<std::mutex> lock( m_range.m_mutex );
+                            m_range.m_ready[index] = true;
+                        }
+                        m_range.m_cond.notify_all();
+                    }
+                }
+
+            private:
+
+                Tile_Range& m_range;
+
+        }; // End of Read_Thread class
+
+        /**
+         * Wait for a tile to be ready
+        */
+        tile_type& acquire( size_t index )
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_cond.wait( lock, [&]{ return m_ready[index]; } );
+            if( m_errors[index] )
+            {
+                std::rethrow_exception( m_errors[index] );
+            }
+            return m_slots[index % m_slots.size()];
+        }
+
+        /**
+         * Hand a tile's slot back to the readers
+        */
+        void release( size_t index )
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_released = std::max( m_released, index + 1 );
+            }
+            m_cond.notify_all();
+        }
+
+        /// Source Image
+        std::shared_ptr<const ImageT> m_image;
+
+        /// Tile regions, in visit order
+        std::vector<math::Rect2i> m_bboxes;
+        std::vector<math::Rect2i> m_halo_bboxes;
+
+        /// Number of reader threads
+        size_t m_num_threads;
+
+        /// Reused tile buffers
+        std::vector<tile_type> m_slots;
+
+        /// Shared state, protected by m_mutex
+        std::mutex                       m_mutex;
+        std::condition_variable          m_cond;
+        size_t                           m_next_tile { 0 };
+        size_t                           m_released { 0 };
+        bool                             m_stop { false };
+        std::vector<bool>                m_ready;
+        std::vector<std::exception_ptr>  m_errors;
+
+        /// Reader threads
+        std::vector<std::shared_ptr<Read_Thread>>         m_workers;
+        std::vector<std::shared_ptr<core::work::Thread>>  m_threads;
+
+}; // End of Tile_Range class
+
+} // End of ops::block namespace
+
+/**
+ * Iterate over an image in tiles
+ *
+ * @code
+ * for( auto& tile : tiles( image, math::Size2i( { 512, 512 } ), 8 ) )
+ * {
+ *     process( tile.image(), tile.bbox() );
+ * }
+ * @endcode
+ *
+ * @param image Source image
+ * @param tile_size Size of each tile, not including the halo
+ * @param halo Number of extra pixels to read around each side of a tile
+ * @param num_threads Number of background rasterization threads
+ * @param read_ahead Number of tile buffers.  Zero picks one more than the thread count.
+*/
+template <typename ImageT>
+ops::block::Tile_Range<ImageT> tiles( const Image_Base<ImageT>& image,
+                                      const math::Size2i&       tile_size,
+                                      int                       halo        = 0,
+                                      size_t                    num_threads = 1,
+                                      size_t                    read_ahead  = 0 )
+{
+    return ops::block::Tile_Range<ImageT>( image.impl(),
+                                           tile_size,
+                                           halo,
+                                           num_threads,
+                                           read_ahead );
+}
+
+/**
+ * Iterate over an image resource in tiles, using the resource's preferred block size.
+ * Resources without block reads are streamed in DEFAULT_RESOURCE_TILE_SIZE tiles,
+ * rather than read whole.
+*/
+template <typename PixelT>
+ops::block::Tile_Range<Image_Resource_View<PixelT>> tiles( Read_Image_Resource_Base::ptr_t resource,
+                                                           int                             halo        = 0,
+                                                           size_t                          num_threads = 1,
+                                                           size_t                          read_ahead  = 0 )
+{
+    const auto tile_size = resource->has_block_read() ? resource->block_read_size()
+                                                      : math::Size2i( { ops::block::DEFAULT_RESOURCE_TILE_SIZE,
+                                                                        ops::block::DEFAULT_RESOURCE_TILE_SIZE } );
+    return ops::block::Tile_Range<Image_Resource_View<PixelT>>( std::make_shared<const Image_Resource_View<PixelT>>( resource ),
+                                                                tile_size,
+                                                                halo,
+                                                                num_threads,
+                                                                read_ahead );
+}
+
+} // End of tmns::image namespace
@@ -52,8 +52,7 @@ class Channel_Clamp_Functor: public Unary_Return_Same_Type
 template <typename ImageT,
           typename LowT,
           typename HighT>
-Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typename ImageT::pixel_type>,
-                                                   typename ImageT::pixel_type > >
+auto
     clamp( const Image_Base<ImageT>& image,
            LowT                      low,
            HighT                     high )
@@ -61,7 +60,7 @@ Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typenam
     typedef Unary_Compound_Functor<Channel_Clamp_Functor<typename ImageT::pixel_type>,
                                    typename ImageT::pixel_type> func_type;
     func_type func( Channel_Clamp_Functor<typename ImageT::pixel_type>(low,high) );
-    return Per_Pixel_View_Unary<ImageT,func_type>( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 /**
@@ -71,8 +70,7 @@ Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typenam
  */
 template <typename ImageT,
           typename HighT>
-Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typename ImageT::pixel_type>,
-                                                   typename ImageT::pixel_type> >
+auto
     clamp( const Image_Base<ImageT>& image, HighT high )
 {
     // Define the functor, which wraps the clamp method.
@@ -83,7 +81,7 @@ Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typenam
     typedef Channel_Range<typename Compound_Channel_Type<typename ImageT::pixel_type>::type> range_type;
     typename Compound_Channel_Type<typename ImageT::pixel_type>::type min_val = range_type::min();
     func_type func( Channel_Clamp_Functor<typename ImageT::pixel_type>(min_val,high) );
-    return Per_Pixel_View_Unary<ImageT,func_type>( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 
@@ -94,8 +92,7 @@ Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typenam
  * and 0 and the largest positve value for integral types.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typename ImageT::pixel_type>,
-                                                   typename ImageT::pixel_type> >
+auto
     clamp( const Image_Base<ImageT>& image )
 {
     typedef Unary_Compound_Functor<Channel_Clamp_Functor<typename ImageT::pixel_type>,
@@ -108,7 +105,7 @@ Per_Pixel_View_Unary<ImageT,Unary_Compound_Functor<Channel_Clamp_Functor<typenam
 
     func_type func( Channel_Clamp_Functor<typename ImageT::pixel_type>( min_val, max_val ) );
 
-    return Per_Pixel_View_Unary<ImageT,func_type>( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 
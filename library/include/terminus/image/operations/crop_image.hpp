@@ -18,6 +18,7 @@
 #include <type_traits>
 
 // Terminus Libraries
+#include <terminus/image/types/image_buffer.hpp>
 #include <terminus/image/types/image_traits.hpp>
 #include <terminus/image/operations/rasterize.hpp>
 
@@ -45,6 +46,12 @@ struct Is_Floating_Point_Indexable<ops::Crop_View<ImageT> >
 template <class ImageT>
 struct Is_Multiply_Accessible<ops::Crop_View<ImageT> > : public Is_Multiply_Accessible<ImageT> {};
 
+/**
+ * A crop of a memory-backed image is a sub-region of the same buffer
+*/
+template <class ImageT>
+struct Is_Memory_Buffered<ops::Crop_View<ImageT> > : public Is_Memory_Buffered<ImageT> {};
+
 namespace ops {
 
 /**
@@ -160,6 +167,30 @@ class Crop_View : public Image_Base<Crop_View<ImageT>>
             return m_child;
         }
 
+        /**
+         * Get the column of the child where the crop starts
+        */
+        offset_type offset_i() const
+        {
+            return m_ci;
+        }
+
+        /**
+         * Get the row of the child where the crop starts
+        */
+        offset_type offset_j() const
+        {
+            return m_cj;
+        }
+
+        /**
+         * Get a buffer referencing the cropped region of a memory-backed child
+        */
+        Image_Buffer buffer() const requires ( Is_Memory_Buffered<ImageT>::value::value )
+        {
+            return m_child.buffer().cropped( math::Rect2i( m_ci, m_cj, m_di, m_dj ) );
+        }
+
         // Pre-Rasterize
         typedef Crop_View<typename ImageT::prerasterize_type> prerasterize_type;
         prerasterize_type prerasterize( const math::Rect2i& bbox ) const
@@ -192,7 +223,7 @@ class Crop_View : public Image_Base<Crop_View<ImageT>>
         int m_di; // Cropped Image Width
         int m_dj; // Cropped Image Height
 
-};
+}; // End of Crop_View class
 
 } // End of tmns::image::ops namespace
 
@@ -223,4 +254,37 @@ ops::Crop_View<ImageT> crop_image( const Image_Base<ImageT>&       image,
     return ops::Crop_View<ImageT>( image.impl(), bbox );
 }
 
+/**
+ * Crop a cropped image.  Collapses into a single crop of the original child.
+ */
+template <typename ImageT>
+ops::Crop_View<ImageT> crop_image( const Image_Base<ops::Crop_View<ImageT>>& image,
+                                   size_t                                    ulx,
+                                   size_t                                    uly,
+                                   size_t                                    width,
+                                   size_t                                    height )
+{
+    typedef typename ops::Crop_View<ImageT>::offset_type offset_type;
+
+    const ops::Crop_View<ImageT>& crop = image.impl();
+    return ops::Crop_View<ImageT>( crop.child(),
+                                   crop.offset_i() + (offset_type) ulx,
+                                   crop.offset_j() + (offset_type) uly,
+                                   width,
+                                   height );
+}
+
+/**
+ * Crop a cropped image.  Collapses into a single crop of the original child.
+*/
+template <typename ImageT, typename BBoxT>
+ops::Crop_View<ImageT> crop_image( const Image_Base<ops::Crop_View<ImageT>>& image,
+                                   const math::Rectangle<BBoxT,2>&           bbox )
+{
+    const ops::Crop_View<ImageT>& crop = image.impl();
+    return ops::Crop_View<ImageT>( crop.child(),
+                                   bbox + math::Point2_<BBoxT>( { (BBoxT) crop.offset_i(),
+                                                                  (BBoxT) crop.offset_j() } ) );
+}
+
 } // End of tmns::image namespace
\ No newline at end of file
@@ -112,7 +112,7 @@ class Channel_Normalize_Retain_Alpha_Functor: public math::Unary_Return_Same_Typ
  * [low,high), but leave the values in the alpha channel untouched.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, Channel_Normalize_Retain_Alpha_Functor<typename ImageT::pixel_type> >
+auto
     normalize_retain_alpha( const Image_Base<ImageT>&                 image,
                             typename pix::Image_Channel_Type<ImageT>::type old_low,
                             typename pix::Image_Channel_Type<ImageT>::type old_high,
@@ -121,15 +121,14 @@ Per_Pixel_View_Unary<ImageT, Channel_Normalize_Retain_Alpha_Functor<typename Ima
 {
     typedef Channel_Normalize_Retain_Alpha_Functor<typename ImageT::pixel_type> func_type;
     func_type func ( old_low, old_high, new_low, new_high );
-    return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 /**
  * Renormalize the values in an image to fall within the range [low,high).
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
-                                                         typename ImageT::pixel_type> >
+auto
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type old_low,
                typename pix::Image_Channel_Type<ImageT>::type old_high,
@@ -143,14 +142,14 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
                                                                             old_high,
                                                                             new_low,
                                                                             new_high ) );
-    return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 /**
  * Renormalize the values in an image to fall within the range [low,high).
  */
 template <class ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>, typename ImageT::pixel_type> >
+auto
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type low,
                typename pix::Image_Channel_Type<ImageT>::type high )
@@ -168,7 +167,7 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
                                                                             low,
                                                                             high ) );
 
-    return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 /**
@@ -177,8 +176,7 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
  * type trait but is generally zero.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
-                                                         typename ImageT::pixel_type> >
+auto
     normalize( const Image_Base<ImageT>&                      image,
                typename pix::Image_Channel_Type<ImageT>::type high )
 {
@@ -197,7 +195,7 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
                                                                             range_type::min(),
                                                                             high ) );
 
-    return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 /**
@@ -207,8 +205,7 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
  * positve value for integral types.
  */
 template <typename ImageT>
-Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
-                                                         typename ImageT::pixel_type> >
+auto
     normalize( const Image_Base<ImageT>& image )
 {
     typedef cmp::Unary_Compound_Functor<Channel_Normalize_Functor<typename ImageT::pixel_type>,
@@ -225,7 +222,7 @@ Per_Pixel_View_Unary<ImageT, cmp::Unary_Compound_Functor<Channel_Normalize_Funct
                                                                             old_max,
                                                                             range_type::min(),
                                                                             range_type::max() ) );
-    return Per_Pixel_View_Unary<ImageT, func_type >( image.impl(), func );
+    return per_pixel_view( image, func );
 }
 
 } // End of tmns::image::ops namespace
\ No newline at end of file
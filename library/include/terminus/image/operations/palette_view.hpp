@@ -0,0 +1,215 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    palette_view.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstdint>
+#include <type_traits>
+
+// Terminus Libraries
+#include <terminus/image/pixel/palette.hpp>
+#include <terminus/image/pixel/pixel_accessor_loose.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_traits.hpp>
+
+namespace tmns::image::ops {
+
+/**
+ * Expands an image of 8-bit palette indices to RGBA, lazily.
+ *
+ * The indices stay at one byte per pixel until the view is rasterized.  Rasterizing
+ * into a memory-backed RGBA u8 image expands whole rows at a time through the palette
+ * table, with no intermediate RGBA copy.
+*/
+template <typename ImageT>
+class Palette_View : public Image_Base<Palette_View<ImageT>>
+{
+    public:
+
+        /// Pixel Type
+        typedef PixelRGBA_u8 pixel_type;
+
+        /// Type returned from pixel operators
+        typedef PixelRGBA_u8 result_type;
+
+        /// Pixel Access Type
+        typedef Pixel_Accessor_Loose<Palette_View<ImageT>> pixel_accessor;
+
+        /// Index Pixel Type
+        typedef typename ImageT::pixel_type index_type;
+
+        static_assert( std::is_same_v<typename math::Compound_Channel_Type<index_type>::type,uint8_t>,
+                       "Palette_View requires 8-bit indices" );
+
+        /**
+         * Constructor
+         * @param image Palette indices
+         * @param palette Color table
+        */
+        Palette_View( const ImageT&         image,
+                      const Palette::ptr_t& palette )
+          : m_child( image ),
+            m_palette( palette ? palette : std::make_shared<const Palette>() )
+        {
+        }
+
+        /**
+         * Get image columns
+        */
+        size_t cols() const
+        {
+            return m_child.cols();
+        }
+
+        /**
+         * Get image rows
+        */
+        size_t rows() const
+        {
+            return m_child.rows();
+        }
+
+        /**
+         * Get image planes
+        */
+        size_t planes() const
+        {
+            return m_child.planes();
+        }
+
+        /**
+         * Get the origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( *this, 0, 0 );
+        }
+
+        /**
+         * Look up a single pixel
+        */
+        result_type operator()( int x, int y, int p = 0 ) const
+        {
+            return (*m_palette)[ index_of( m_child( x, y, p ) ) ];
+        }
+
+        /**
+         * Get the color palette
+        */
+        const Palette::ptr_t& palette() const
+        {
+            return m_palette;
+        }
+
+        /**
+         * Get the index image
+        */
+        const ImageT& child() const
+        {
+            return m_child;
+        }
+
+        /**
+         * Pre-Rasterize
+        */
+        typedef Palette_View<typename ImageT::prerasterize_type> prerasterize_type;
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            return prerasterize_type( m_child.prerasterize( bbox ), m_palette );
+        }
+
+        /**
+         * Rasterize the indices for the region, then expand them into the destination
+        */
+        template <typename DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            Image_Memory<index_type> indices( bbox.width(), bbox.height(), planes() );
+            m_child.rasterize( indices, bbox );
+
+            if constexpr( Is_Memory_Buffered<DestT>::value::value &&
+                          std::is_same_v<typename DestT::pixel_type,PixelRGBA_u8> )
+            {
+                Image_Buffer src = indices.buffer();
+                Image_Buffer dst = dest.buffer();
+                for( int p = 0; p < (int)planes();     ++p ) {
+                for( int y = 0; y < bbox.height(); ++y ) {
+                    m_palette->expand( (const uint8_t*) src( 0, y, p ),
+                                       src.cstride(),
+                                       bbox.width(),
+                                       (uint8_t*) dst( 0, y, p ),
+                                       dst.cstride() );
+                }}
+            }
+            else
+            {
+                for( int p = 0; p < (int)planes();     ++p ) {
+                for( int y = 0; y < bbox.height(); ++y ) {
+                for( int x = 0; x < bbox.width();  ++x ) {
+                    dest( x, y, p ) = (*m_palette)[ index_of( indices( x, y, p ) ) ];
+                }}}
+            }
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Palette_View";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + ImageT::full_name() + ">";
+        }
+
+    private:
+
+        /**
+         * Get the palette index stored in a pixel
+        */
+        static uint8_t index_of( const index_type& pix )
+        {
+            if constexpr( std::is_arithmetic_v<index_type> )
+            {
+                return pix;
+            }
+            else
+            {
+                return pix[0];
+            }
+        }
+
+        /// Palette Indices
+        ImageT m_child;
+
+        /// Color Table
+        Palette::ptr_t m_palette;
+
+}; // End of Palette_View class
+
+/**
+ * Lazily expand an image of palette indices to RGBA
+*/
+template <typename ImageT>
+Palette_View<ImageT> palette_view( const Image_Base<ImageT>& image,
+                                   const Palette::ptr_t&     palette )
+{
+    return Palette_View<ImageT>( image.impl(), palette );
+}
+
+} // End of tmns::image::ops namespace
@@ -0,0 +1,125 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    compose_functor.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include <terminus/image/operations/per_pixel_views/per_pixel_accessor_unary.hpp>
+#include <terminus/image/pixel/pixel_accessor_rows.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace tmns::image::ops {
+
+/**
+ * Applies one functor to the result of another, so two stacked per-pixel views
+ * can be evaluated as one.
+*/
+template <typename FirstT,
+          typename SecondT>
+class Compose_Functor
+{
+    public:
+
+        /**
+         * Constructor
+         * @param first Functor applied to the input pixel
+         * @param second Functor applied to the result of the first
+        */
+        Compose_Functor( const FirstT&  first,
+                         const SecondT& second )
+          : m_first( first ),
+            m_second( second )
+        {
+        }
+
+        /**
+         * Apply both functors to a single pixel
+        */
+        template <typename ArgumentT>
+        auto operator()( const ArgumentT& pixel ) const
+            -> std::remove_cvref_t<std::invoke_result_t<const SecondT&,
+                                                        std::invoke_result_t<const FirstT&,const ArgumentT&>>>
+        {
+            return m_second( m_first( pixel ) );
+        }
+
+        /**
+         * Apply both functors to a batch of pixels.  Fuses into a single loop, unless
+         * either functor has its own batched overload, in which case the intermediate
+         * pixels go through a stack buffer.
+        */
+        template <typename InputT,
+                  typename OutputT>
+        void operator()( std::span<const InputT> input,
+                         std::span<OutputT>      output ) const
+        {
+            typedef std::remove_cvref_t<std::invoke_result_t<const FirstT&,const InputT&>> middle_type;
+
+            if constexpr( Has_Batched_Call<FirstT,InputT,middle_type>::value::value ||
+                          Has_Batched_Call<SecondT,middle_type,OutputT>::value::value )
+            {
+                std::array<middle_type,ROW_BATCH_SIZE> middle;
+                for( size_t offset = 0; offset < input.size(); offset += ROW_BATCH_SIZE )
+                {
+                    const size_t count = std::min( ROW_BATCH_SIZE, input.size() - offset );
+                    apply_batch( m_first,
+                                 input.subspan( offset, count ),
+                                 std::span<middle_type>( middle.data(), count ) );
+                    apply_batch( m_second,
+                                 std::span<const middle_type>( middle.data(), count ),
+                                 output.subspan( offset, count ) );
+                }
+            }
+            else
+            {
+                for( size_t i = 0; i < input.size(); ++i )
+                {
+                    output[i] = m_second( m_first( input[i] ) );
+                }
+            }
+        }
+
+        /**
+         * Get the functor applied first
+        */
+        const FirstT& first() const
+        {
+            return m_first;
+        }
+
+        /**
+         * Get the functor applied second
+        */
+        const SecondT& second() const
+        {
+            return m_second;
+        }
+
+    private:
+
+        /// Functor applied to the input pixel
+        FirstT m_first;
+
+        /// Functor applied to the result of the first
+        SecondT m_second;
+
+}; // End of Compose_Functor class
+
+} // End of tmns::image::ops namespace
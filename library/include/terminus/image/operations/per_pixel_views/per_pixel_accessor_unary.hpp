@@ -14,8 +14,39 @@
 */
 #pragma once
 
+// Terminus Image Libraries
+#include <terminus/image/pixel/pixel_accessor_rows.hpp>
+
+// C++ Libraries
+#include <span>
+#include <type_traits>
+
 namespace tmns::image::ops {
 
+/**
+ * Apply a functor to a batch of pixels.  Uses the functor's batched overload
+ * when it has one, otherwise calls it once per pixel.
+*/
+template <typename FunctorT,
+          typename InputT,
+          typename OutputT>
+void apply_batch( const FunctorT&         func,
+                  std::span<const InputT> input,
+                  std::span<OutputT>      output )
+{
+    if constexpr( Has_Batched_Call<FunctorT,InputT,OutputT>::value::value )
+    {
+        func( input, output );
+    }
+    else
+    {
+        for( size_t i = 0; i < input.size(); ++i )
+        {
+            output[i] = func( input[i] );
+        }
+    }
+}
+
 /**
  * Pixel accessor for operating on Unary Image-Views
 */
@@ -93,6 +124,22 @@ class Per_Pixel_Accessor_Unary
             return m_func(*m_iter);
         }
 
+        /**
+         * Apply the functor to the next `n` pixels of the row, writing them into `output`.
+         * Available when the child can produce whole rows, so chains of per-pixel views
+         * run as one tight loop per batch rather than one accessor chain per pixel.
+         * Functors with a batched overload (see Has_Batched_Call) get each batch in one call.
+        */
+        void read_row( pixel_type* output, size_t n ) const
+            requires ( has_row_access<ImageIterT>() )
+        {
+            typedef std::remove_const_t<typename ImageIterT::pixel_type> input_type;
+
+            visit_row( m_iter, n, [&]( std::span<const input_type> input, size_t offset ) {
+                apply_batch( m_func, input, std::span<pixel_type>( output + offset, input.size() ) );
+            });
+        }
+
     private:
 
         /// @brief  Image Iterator
@@ -17,7 +17,9 @@
 // Terminus Image Libraries
 #include "../../types/Image_Base.hpp"
 #include "../../types/Image_Traits.hpp"
+#include "../crop_image.hpp"
 #include "../rasterize.hpp"
+#include "compose_functor.hpp"
 #include "Per_Pixel_Accessor_Unary.hpp"
 
 // C++ Libraries
@@ -104,6 +106,22 @@ class Per_Pixel_View_Unary : public Image_Base<Per_Pixel_View_Unary<ImageT,Funct
             return m_func( m_image( x, y, p ) );
         }
 
+        /**
+         * Get the image the functor is applied to
+        */
+        const ImageT& child() const
+        {
+            return m_image;
+        }
+
+        /**
+         * Get the functor
+        */
+        const FunctorT& functor() const
+        {
+            return m_func;
+        }
+
         /**
          * Re-assign the image.
          */
@@ -146,8 +164,74 @@ class Per_Pixel_View_Unary : public Image_Base<Per_Pixel_View_Unary<ImageT,Funct
         FunctorT  m_func;
 }; // End of Per_Pixel_View_Unary class
 
+/**
+ * Apply a functor to every pixel of an image
+*/
+template <typename ImageT,
+          typename FunctorT>
+Per_Pixel_View_Unary<ImageT,FunctorT> per_pixel_view( const Image_Base<ImageT>& image,
+                                                      const FunctorT&           func )
+{
+    return Per_Pixel_View_Unary<ImageT,FunctorT>( image.impl(), func );
+}
+
+/**
+ * Apply a functor on top of another per-pixel view.  The two functors are composed
+ * into one, so a chain of per-pixel views costs a single view.  Functors returning
+ * references are left stacked, since those views can be written through.
+*/
+template <typename ImageT,
+          typename InnerT,
+          typename FunctorT>
+auto per_pixel_view( const Image_Base<Per_Pixel_View_Unary<ImageT,InnerT>>& image,
+                     const FunctorT&                                        func )
+{
+    typedef Per_Pixel_View_Unary<ImageT,InnerT> inner_view_type;
+    typedef std::invoke_result_t<const FunctorT&,typename inner_view_type::result_type> outer_result_type;
+
+    const inner_view_type& inner = image.impl();
+    if constexpr( std::is_reference_v<outer_result_type> )
+    {
+        return Per_Pixel_View_Unary<inner_view_type,FunctorT>( inner, func );
+    }
+    else
+    {
+        return per_pixel_view( inner.child(),
+                               Compose_Functor<InnerT,FunctorT>( inner.functor(), func ) );
+    }
+}
+
 } // End of ops namespace
 
+/**
+ * Crop a per-pixel view.  The crop is applied to the child instead, so only the
+ * cropped region is prerasterized and the functor is left on top.
+*/
+template <typename ImageT,
+          typename FunctorT>
+auto crop_image( const Image_Base<ops::Per_Pixel_View_Unary<ImageT,FunctorT>>& image,
+                 size_t                                                         ulx,
+                 size_t                                                         uly,
+                 size_t                                                         width,
+                 size_t                                                         height )
+{
+    return ops::per_pixel_view( crop_image( image.impl().child(), ulx, uly, width, height ),
+                                image.impl().functor() );
+}
+
+/**
+ * Crop a per-pixel view.  The crop is applied to the child instead.
+*/
+template <typename ImageT,
+          typename FunctorT,
+          typename BBoxT>
+auto crop_image( const Image_Base<ops::Per_Pixel_View_Unary<ImageT,FunctorT>>& image,
+                 const math::Rectangle<BBoxT,2>&                                bbox )
+{
+    return ops::per_pixel_view( crop_image( image.impl().child(), bbox ),
+                                image.impl().functor() );
+}
+
 /**
  * Allow multiplication
 */
@@ -27,9 +27,9 @@ namespace tmns::image::ops {
 */
 template< typename PixelT,
           typename ImageT >
-Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Rescale_Functor<PixelT>> pixel_cast_rescale( const Image_Base<ImageT>& image )
+auto pixel_cast_rescale( const Image_Base<ImageT>& image )
 {
-    return Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Rescale_Functor<PixelT>>( image.impl() );
+    return per_pixel_view( image, pix::Pixel_Cast_Rescale_Functor<PixelT>() );
 }
 
 
@@ -38,9 +38,9 @@ Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Rescale_Functor<PixelT>> pixel_cast_
 */
 template< typename PixelT,
           typename ImageT >
-Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Functor<PixelT>> pixel_cast( const Image_Base<ImageT>& image )
+auto pixel_cast( const Image_Base<ImageT>& image )
 {
-    return Per_Pixel_View_Unary<ImageT,pix::Pixel_Cast_Functor<PixelT>>( image.impl() );
+    return per_pixel_view( image, pix::Pixel_Cast_Functor<PixelT>() );
 }
 
 
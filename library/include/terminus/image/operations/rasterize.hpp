@@ -19,9 +19,57 @@
 #include <terminus/math/rectangle.hpp>
 
 // Terminus Image Methods
+#include <terminus/image/pixel/pixel_accessor_rows.hpp>
 #include <terminus/image/types/image_traits.hpp>
 
+// C++ Libraries
+#include <span>
+#include <type_traits>
+#include <utility>
+
 namespace tmns::image::ops {
+namespace impl {
+
+/**
+ * Check if rows can be moved from the source accessor into the destination as whole
+ * batches.  The destination must expose a writable row span.
+*/
+template <class SrcAccT, class DestAccT>
+constexpr bool is_row_batchable()
+{
+    if constexpr( Has_Row_Span<DestAccT>::value::value && has_row_access<SrcAccT>() )
+    {
+        return std::is_convertible_v<decltype( std::declval<const DestAccT&>().row_span( 0 ) ),
+                                     std::span<typename DestAccT::pixel_type>>;
+    }
+    return false;
+}
+
+/**
+ * Fill a destination row from the source accessor, converting pixels if the types differ
+*/
+template <class SrcAccT, class DestPixelT>
+void rasterize_row( const SrcAccT&         src,
+                    std::span<DestPixelT>  dest )
+{
+    typedef std::remove_const_t<typename SrcAccT::pixel_type> SrcPixelT;
+
+    if constexpr( std::is_same_v<SrcPixelT,DestPixelT> && Has_Row_Read<SrcAccT>::value::value )
+    {
+        src.read_row( dest.data(), dest.size() );
+    }
+    else
+    {
+        visit_row( src, dest.size(), [&]( auto input, size_t offset ) {
+            for( size_t i = 0; i < input.size(); ++i )
+            {
+                dest[offset + i] = DestPixelT( input[i] );
+            }
+        });
+    }
+}
+
+} // End of impl namespace
 
 
 /**
@@ -64,21 +112,29 @@ void rasterize( const SrcT&          src,
         DestAccT drow = dplane;
         for( int row=bbox.height(); row; --row )
         {
-            SrcAccT  scol = srow;
-            DestAccT dcol = drow;
-            for( int col = bbox.width(); col; --col )
+            // Whole rows at a time when both sides support it
+            if constexpr( impl::is_row_batchable<SrcAccT,DestAccT>() )
+            {
+                impl::rasterize_row( srow, drow.row_span( bbox.width() ) );
+            }
+            else
             {
+                SrcAccT  scol = srow;
+                DestAccT dcol = drow;
+                for( int col = bbox.width(); col; --col )
+                {
 #ifdef __llvm__
-                // LLVM doesn't like ProceduralPixelAccessor's operator*
-                // that returns a non reference. We can work around if we
-                // split the command in two lines.
-                DestPixelT buffer(*scol);
-                *dcol = buffer;
+                    // LLVM doesn't like ProceduralPixelAccessor's operator*
+                    // that returns a non reference. We can work around if we
+                    // split the command in two lines.
+                    DestPixelT buffer(*scol);
+                    *dcol = buffer;
 #else
-                *dcol = DestPixelT(*scol);
+                    *dcol = DestPixelT(*scol);
 #endif
-                scol.next_col();
-                dcol.next_col();
+                    scol.next_col();
+                    dcol.next_col();
+                }
             }
             srow.next_row();
             drow.next_row();
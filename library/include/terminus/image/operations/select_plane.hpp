@@ -16,8 +16,25 @@
 
 // Terminus Image Libraries
 #include <terminus/image/operations/rasterize.hpp>
+#include <terminus/image/types/image_buffer.hpp>
+#include <terminus/image/types/image_traits.hpp>
 
-namespace tmns::image::ops {
+namespace tmns::image {
+namespace ops {
+
+// Forward Declaration
+template <class ImageT>
+class Select_Plane_View;
+
+} // End of ops namespace
+
+/**
+ * A single plane of a memory-backed image is still memory-backed
+*/
+template <class ImageT>
+struct Is_Memory_Buffered<ops::Select_Plane_View<ImageT> > : public Is_Memory_Buffered<ImageT> {};
+
+namespace ops {
 
 /**
  * Return a single plane from a multi-plane image
@@ -110,6 +127,14 @@ class Select_Plane_View : public Image_Base<Select_Plane_View<ImageT> >
             return *this;
         }
 
+        /**
+         * Get a buffer referencing the selected plane of a memory-backed child
+        */
+        Image_Buffer buffer() const requires ( Is_Memory_Buffered<ImageT>::value::value )
+        {
+            return m_child.buffer().plane( m_plane );
+        }
+
         /**
          * Pre-rasterize image
         */
@@ -150,4 +175,5 @@ Select_Plane_View<ImageT> select_plane( const Image_Base<ImageT>& image,
     return Select_Plane_View<ImageT>( image.impl(), plane );
 }
 
-} // end of tmns::image::ops namespace
\ No newline at end of file
+} // End of ops namespace
+} // End of tmns::image namespace
\ No newline at end of file
@@ -14,6 +14,9 @@
 */
 #pragma once
 
+// C++ Libraries
+#include <optional>
+
 // Terminus Libraries
 #include <terminus/error.hpp>
 
@@ -43,4 +46,21 @@ Result<void> convert( const Image_Buffer&  dst,
                       const Image_Buffer&  src,
                       bool                 rescale = false );
 
+/**
+ * Convert pixel data into a masked destination, such as Pixel_Mask<PixelGray_f32>.
+ *
+ * The data channels are converted as in convert(), and the validity channel is
+ * filled in the same call.  A pixel is invalid when every source channel equals
+ * the nodata value (NaN matches NaN).  Without a nodata value, every pixel is valid.
+ *
+ * @param dst Destination pixel container.  Unmasked destinations fall through to convert().
+ * @param src Source pixel data.  Must not be masked.
+ * @param nodata Source value marking pixels without data
+ * @param rescale Flag if we need to scale imagery
+*/
+Result<void> convert_masked( const Image_Buffer&    dst,
+                             const Image_Buffer&    src,
+                             std::optional<double>  nodata,
+                             bool                   rescale = false );
+
 } // End of tmns::image namespace
\ No newline at end of file
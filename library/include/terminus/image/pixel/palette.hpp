@@ -0,0 +1,111 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    palette.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include <terminus/image/pixel/pixel_rgba.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace tmns::image {
+
+/**
+ * Color table for paletted (indexed) images.
+ *
+ * The table always holds 256 entries so that every 8-bit index is valid.  Entries
+ * past the number of colors in the file are transparent black.
+*/
+class Palette
+{
+    public:
+
+        /// Pointer Type.  Palettes are shared between resources and views.
+        typedef std::shared_ptr<const Palette> ptr_t;
+
+        /**
+         * Default Constructor.  Every entry is transparent black.
+        */
+        Palette() = default;
+
+        /**
+         * Build the table from a list of colors.  Colors past the 256th are ignored.
+        */
+        explicit Palette( const std::vector<PixelRGBA_u8>& colors )
+          : m_size( std::min<size_t>( colors.size(), 256 ) )
+        {
+            std::copy( colors.begin(), colors.begin() + m_size, m_table.begin() );
+        }
+
+        /**
+         * Number of colors defined by the file
+        */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * Look up a single index
+        */
+        const PixelRGBA_u8& operator[]( uint8_t index ) const
+        {
+            return m_table[index];
+        }
+
+        /**
+         * Expand a row of indices.  Both rows may be strided, given in bytes.
+         *
+         * The contiguous case is a plain table lookup per pixel, which compilers
+         * turn into a vector gather.
+        */
+        void expand( const uint8_t* indices,
+                     size_t         index_stride,
+                     size_t         count,
+                     uint8_t*       output,
+                     size_t         output_stride ) const
+        {
+            static_assert( sizeof( PixelRGBA_u8 ) == 4, "PixelRGBA_u8 must be packed" );
+
+            if( index_stride == 1 && output_stride == sizeof( PixelRGBA_u8 ) )
+            {
+                for( size_t i = 0; i < count; ++i )
+                {
+                    std::memcpy( output + 4 * i, &m_table[indices[i]], 4 );
+                }
+                return;
+            }
+            for( size_t i = 0; i < count; ++i )
+            {
+                std::memcpy( output + i * output_stride, &m_table[indices[i * index_stride]], 4 );
+            }
+        }
+
+    private:
+
+        /// Color for every possible index
+        std::array<PixelRGBA_u8,256> m_table {};
+
+        /// Number of colors defined by the file
+        size_t m_size { 0 };
+
+}; // End of Palette class
+
+} // End of tmns::image namespace
@@ -14,6 +14,10 @@
 */
 #pragma once
 
+// C++ Libraries
+#include <algorithm>
+#include <span>
+#include <type_traits>
 
 namespace tmns::image {
 
@@ -184,6 +188,22 @@ class Pixel_Accessor_MemStride
             return *m_ptr;
         }
 
+        /**
+         * Get the next `n` pixels of the row, starting at the current position
+        */
+        std::span<PixelT> row_span( size_t n ) const
+        {
+            return std::span<PixelT>( m_ptr, n );
+        }
+
+        /**
+         * Copy the next `n` pixels of the row, starting at the current position
+        */
+        void read_row( std::remove_const_t<PixelT>* output, size_t n ) const
+        {
+            std::copy( m_ptr, m_ptr + n, output );
+        }
+
         ssize_t distance() const
         {
             return std::distance( m_origin, m_ptr );
@@ -0,0 +1,77 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    pixel_accessor_rows.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include <terminus/image/types/image_traits.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace tmns::image {
+
+/// Number of pixels copied out of an accessor at a time when it cannot expose its row directly
+static constexpr size_t ROW_BATCH_SIZE = 256;
+
+/**
+ * Check if an accessor can produce whole rows, either as a span or into a buffer
+*/
+template <typename AccessorT>
+constexpr bool has_row_access()
+{
+    return Has_Row_Span<AccessorT>::value::value || Has_Row_Read<AccessorT>::value::value;
+}
+
+/**
+ * Visit the next `n` pixels of the accessor's row as contiguous batches.
+ *
+ * Accessors with a row span are visited in a single batch with no copy.  Others are
+ * copied out through `read_row()`, ROW_BATCH_SIZE pixels at a time.
+ *
+ * @param acc Accessor positioned at the first pixel
+ * @param n Number of pixels
+ * @param func Called as `func( std::span<const pixel_type> batch, size_t offset )`
+*/
+template <typename AccessorT,
+          typename FuncT>
+void visit_row( const AccessorT& acc,
+                size_t           n,
+                FuncT&&          func )
+{
+    typedef std::remove_const_t<typename AccessorT::pixel_type> pixel_type;
+
+    if constexpr( Has_Row_Span<AccessorT>::value::value )
+    {
+        func( std::span<const pixel_type>( acc.row_span( n ) ), 0 );
+    }
+    else
+    {
+        std::array<pixel_type,ROW_BATCH_SIZE> batch;
+        AccessorT iter = acc;
+        for( size_t offset = 0; offset < n; offset += ROW_BATCH_SIZE )
+        {
+            const size_t count = std::min( ROW_BATCH_SIZE, n - offset );
+            iter.read_row( batch.data(), count );
+            func( std::span<const pixel_type>( batch.data(), count ), offset );
+            iter.advance( count, 0 );
+        }
+    }
+}
+
+} // End of tmns::image namespace
@@ -0,0 +1,244 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    pixel_accessor_tiled.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// C++ Libraries
+#include <cstddef>
+#include <string>
+#include <sys/types.h>
+
+namespace tmns::image {
+
+/**
+ * A pixel accessor for images stored as square tiles, such as `Image_Tiled`.
+ *
+ * Tiles are TileSize x TileSize pixels, stored contiguously and in row-major order
+ * across the image.  The accessor tracks its position and resolves the address
+ * on dereference.
+*/
+template <typename PixelT, size_t TileSize>
+class Pixel_Accessor_Tiled
+{
+    public:
+
+        static_assert( TileSize > 0 && ( TileSize & ( TileSize - 1 ) ) == 0,
+                       "Tile size must be a power of two" );
+
+        /// @brief  Image Pixel Type
+        typedef PixelT pixel_type;
+
+        /// @brief Resulting Image Type (Notice Reference)
+        typedef PixelT& result_type;
+
+        /// @brief Offset Type
+        typedef ssize_t offset_type;
+
+        /**
+         * Constructor
+         *
+         * @param data Pointer to the first tile
+         * @param tiles_per_row Number of tiles across the image
+         * @param pstride Plane-stride in pixels
+        */
+        Pixel_Accessor_Tiled( PixelT* data,
+                              ssize_t tiles_per_row,
+                              ssize_t pstride )
+          : m_data( data ),
+            m_tiles_per_row( tiles_per_row ),
+            m_pstride( pstride )
+        {
+        }
+
+        /**
+         * Advance the iterator to the next column
+        */
+        Pixel_Accessor_Tiled&  next_col() { ++m_col; return *this; }
+
+        /**
+         * Advance the iterator to the next column
+         * Const-capable, resulting in copy of the iterator
+         */
+        Pixel_Accessor_Tiled next_col_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.next_col();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the previous column
+        */
+        Pixel_Accessor_Tiled&  prev_col() { --m_col; return *this; }
+
+        /**
+         * Advance the iterator to the previous column.
+         * Const-capable, resulting in copy of the iterator
+         */
+        Pixel_Accessor_Tiled prev_col_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.prev_col();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the next row
+        */
+        Pixel_Accessor_Tiled&  next_row() { ++m_row; return *this; }
+
+        /**
+         * Advance the iterator to the next row.
+         * Const-capable, resulting in copy of the iterator
+         */
+        Pixel_Accessor_Tiled next_row_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.next_row();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the previous row
+        */
+        Pixel_Accessor_Tiled&  prev_row() { --m_row; return *this; }
+
+        /**
+         * Advance the iterator to the previous row.
+         * Const-capable, resulting in copy of the iterator
+         */
+        Pixel_Accessor_Tiled prev_row_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.prev_row();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the next image plane
+        */
+        Pixel_Accessor_Tiled&  next_plane() { ++m_plane; return *this; }
+
+        /**
+         * Advance the iterator to the next image plane.
+         * Const-capable, resulting in a copy of the iterator.
+        */
+        Pixel_Accessor_Tiled next_plane_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.next_plane();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the previous image plane
+        */
+        Pixel_Accessor_Tiled&  prev_plane() { --m_plane; return *this; }
+
+        /**
+         * Advance the iterator to the previous image plane.
+         * Const-capable, resulting in a copy of the iterator.
+         */
+        Pixel_Accessor_Tiled prev_plane_copy() const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.prev_plane();
+            return tmp;
+        }
+
+        /**
+         * Advance the iterator to the specified position in offsets.
+        */
+        Pixel_Accessor_Tiled&  advance( ssize_t diff_cols,
+                                        ssize_t diff_rows,
+                                        ssize_t diff_planes = 0 )
+        {
+            m_col   += diff_cols;
+            m_row   += diff_rows;
+            m_plane += diff_planes;
+            return *this;
+        }
+
+        /**
+         * Advance the iterator to the specified position in offsets.
+         * Const-capable, resulting in a copy of the iterator.
+         */
+        Pixel_Accessor_Tiled advance_copy ( ssize_t diff_cols,
+                                            ssize_t diff_rows,
+                                            ssize_t diff_planes = 0 ) const
+        {
+            Pixel_Accessor_Tiled tmp(*this);
+            tmp.advance( diff_cols,
+                         diff_rows,
+                         diff_planes );
+            return tmp;
+        }
+
+        /**
+         * Operator returns the pixel value at the current location
+        */
+        result_type operator* () const
+        {
+            return m_data[ offset( m_col, m_row, m_plane ) ];
+        }
+
+        /**
+         * Offset of a pixel from the start of the data, in pixels
+        */
+        ssize_t offset( ssize_t col,
+                        ssize_t row,
+                        ssize_t plane ) const
+        {
+            constexpr ssize_t tile_size = static_cast<ssize_t>( TileSize );
+            constexpr ssize_t tile_mask = tile_size - 1;
+
+            const ssize_t tile = ( row / tile_size ) * m_tiles_per_row + ( col / tile_size );
+            return plane * m_pstride
+                 + tile * tile_size * tile_size
+                 + ( row & tile_mask ) * tile_size
+                 + ( col & tile_mask );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Pixel_Accessor_Tiled";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + pixel_type::class_name() + ">";
+        }
+
+    private:
+
+        /// @brief Pointer to the first tile
+        PixelT* m_data { nullptr };
+
+        /// @brief Number of tiles across the image
+        ssize_t m_tiles_per_row { 0 };
+
+        /// @brief  Plane-Stride
+        ssize_t m_pstride { 0 };
+
+        /// @brief Current Position
+        ssize_t m_col { 0 };
+        ssize_t m_row { 0 };
+        ssize_t m_plane { 0 };
+
+}; // End of Pixel_Accessor_Tiled Class
+
+} // end of tmns::image namespace
@@ -22,6 +22,9 @@
 #include <terminus/image/pixel/channel_cast_utilities.hpp>
 #include <terminus/math/types/functors.hpp>
 
+// C++ Libraries
+#include <span>
+
 namespace tmns::image::pix {
 
 /**
@@ -253,6 +256,19 @@ struct Pixel_Cast_Functor : private math::Return_Fixed_Type<PixelT>
         return pixel_cast<PixelT>( pixel );
    }
 
+    /**
+     * Cast a batch of pixels
+    */
+   template <typename ArgumentT>
+   void operator()( std::span<const ArgumentT> input,
+                    std::span<PixelT>          output ) const
+   {
+        for( size_t i = 0; i < input.size(); ++i )
+        {
+            output[i] = pixel_cast<PixelT>( input[i] );
+        }
+   }
+
 }; // End of Pixel_Cast_Functor
 
 /**
@@ -269,6 +285,19 @@ struct Pixel_Cast_Rescale_Functor : private math::Return_Fixed_Type<PixelT>
         {
             return pixel_cast_rescale<PixelT>( pixel );
         }
+
+        /**
+         * Cast a batch of pixels
+        */
+        template <typename ArgumentT>
+        void operator()( std::span<const ArgumentT> input,
+                         std::span<PixelT>          output ) const
+        {
+            for( size_t i = 0; i < input.size(); ++i )
+            {
+                output[i] = pixel_cast_rescale<PixelT>( input[i] );
+            }
+        }
 }; // End of Pixel_Cast_Rescale_Functor
 
 } // End of tmns::image::pix namespace
\ No newline at end of file
@@ -65,4 +65,41 @@ std::string enum_to_string( Pixel_Format_Enum val );
 */
 Result<int> num_channels( Pixel_Format_Enum value );
 
+/**
+ * Check if the pixel format carries a trailing validity channel.
+*/
+constexpr bool is_masked( Pixel_Format_Enum value )
+{
+    return value >= Pixel_Format_Enum::UNKNOWN_MASKED &&
+           value <= Pixel_Format_Enum::LAB_MASKED;
+}
+
+/**
+ * Get the masked version of a core pixel format (i.e. GRAY -> GRAY_MASKED).
+ * Masked and generic formats are returned unchanged.
+*/
+constexpr Pixel_Format_Enum to_masked( Pixel_Format_Enum value )
+{
+    if( value > Pixel_Format_Enum::LAB )
+    {
+        return value;
+    }
+    return static_cast<Pixel_Format_Enum>( static_cast<int>( value ) +
+                                           static_cast<int>( Pixel_Format_Enum::UNKNOWN_MASKED ) );
+}
+
+/**
+ * Get the core pixel format underneath a masked format (i.e. GRAY_MASKED -> GRAY).
+ * Unmasked formats are returned unchanged.
+*/
+constexpr Pixel_Format_Enum to_unmasked( Pixel_Format_Enum value )
+{
+    if( !is_masked( value ) )
+    {
+        return value;
+    }
+    return static_cast<Pixel_Format_Enum>( static_cast<int>( value ) -
+                                           static_cast<int>( Pixel_Format_Enum::UNKNOWN_MASKED ) );
+}
+
 } // End of tmns::image namespace
\ No newline at end of file
@@ -23,6 +23,8 @@
 
 namespace tmns::image {
 
+template <typename PixelT> class Pixel_Mask;
+
 /**
  * Simple class for converting a formal Pixel-Type into a Pixel-Type-Enum
 */
@@ -56,6 +58,12 @@ template <typename ChannelT> struct Pixel_Format_ID<Pixel_RGBA<ChannelT>>
     static const Pixel_Format_Enum value = Pixel_Format_Enum::RGBA;
 };
 
+/// Masked Types
+template <typename PixelT> struct Pixel_Format_ID<Pixel_Mask<PixelT>>
+{
+    static const Pixel_Format_Enum value = to_masked( Pixel_Format_ID<PixelT>::value );
+};
+
 /// Scalar Types
 template <> struct Pixel_Format_ID<int8_t>{   static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
 template <> struct Pixel_Format_ID<uint8_t>{  static const Pixel_Format_Enum value = Pixel_Format_Enum::SCALAR; };
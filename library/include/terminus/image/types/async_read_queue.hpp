@@ -0,0 +1,113 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    async_read_queue.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+/// External Terminus Libraries
+#include <terminus/error.hpp>
+
+// C++ Libraries
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tmns::core::work {
+class Thread;
+} // End of tmns::core::work namespace
+
+namespace tmns::image {
+
+/**
+ * Process-wide pool of I/O threads which services asynchronous resource reads.
+ *
+ * Reads are submitted in batches under a single lock, so a caller can queue every
+ * tile it needs at once and keep far more reads in flight than it has threads of its own.
+ * Reads are serviced in submission order.
+*/
+class Async_Read_Queue
+{
+    public:
+
+        /// Read job
+        typedef std::packaged_task<Result<void>()> job_type;
+
+        /**
+         * Constructor
+         *
+         * @param num_threads Number of I/O threads
+        */
+        Async_Read_Queue( size_t num_threads );
+
+        /**
+         * Destructor.  Finishes all queued reads before returning.
+        */
+        ~Async_Read_Queue();
+
+        /**
+         * Get the shared queue.  Created on first use.
+        */
+        static Async_Read_Queue& instance();
+
+        /**
+         * Default number of I/O threads.  Reads mostly wait on the device, so
+         * this is larger than the core count.
+        */
+        static size_t default_num_threads();
+
+        /**
+         * Queue a batch of reads
+         *
+         * @return One future per job, in the same order
+        */
+        std::vector<std::future<Result<void>>> submit( std::vector<job_type> jobs );
+
+        /**
+         * Get the number of reads queued but not yet started
+        */
+        size_t pending() const;
+
+    private:
+
+        /**
+         * I/O worker loop
+        */
+        class Worker
+        {
+            public:
+
+                Worker( Async_Read_Queue& queue ) : m_queue( queue ) {}
+
+                void operator()();
+
+            private:
+
+                Async_Read_Queue& m_queue;
+
+        }; // End of Worker class
+
+        /// Queued reads, protected by m_mutex
+        mutable std::mutex       m_mutex;
+        std::condition_variable  m_cond;
+        std::deque<job_type>     m_jobs;
+        bool                     m_stop { false };
+
+        /// I/O threads
+        std::vector<std::shared_ptr<core::work::Thread>> m_threads;
+
+}; // End of Async_Read_Queue class
+
+} // End of tmns::image namespace
@@ -16,9 +16,16 @@
 
 // Terminus Image Libraries
 #include "Image_Base.hpp"
+#include "Image_Memory.hpp"
+#include "Image_Traits.hpp"
+#include "../pixel/pixel_accessor_rows.hpp"
 
 // Terminus Libraries
 #include <terminus/core/utility/Progress_Callback.hpp>
+#include <terminus/math/Point_Utilities.hpp>
+
+// C++ Libraries
+#include <algorithm>
 
 namespace tmns::image {
 
@@ -40,11 +47,32 @@ void for_each_pixel_( const Image_Base<ImageT>&         image_,
         for( int row = 0; row < image.rows(); ++row ) // Loop through rows
         { 
             progress.report_fractional_progress( row, image.rows() );
-            pixel_accessor col_acc = row_acc;
-            for( int col = image.cols(); col; --col ) // Loop through columns
+            if constexpr( Has_Row_Span<pixel_accessor>::value::value )
+            {
+                // Contiguous row, so the functor sees the pixels themselves
+                for( auto& pix : row_acc.row_span( image.cols() ) )
+                {
+                    func( pix );
+                }
+            }
+            else if constexpr( Has_Row_Read<pixel_accessor>::value::value )
             {
-                func( *col_acc );  // Apply the functor to this pixel value
-                col_acc.next_col();
+                // Computed row, produced a batch at a time
+                visit_row( row_acc, image.cols(), [&]( auto input, size_t ) {
+                    for( const auto& pix : input )
+                    {
+                        func( pix );
+                    }
+                });
+            }
+            else
+            {
+                pixel_accessor col_acc = row_acc;
+                for( int col = image.cols(); col; --col ) // Loop through columns
+                {
+                    func( *col_acc );  // Apply the functor to this pixel value
+                    col_acc.next_col();
+                }
             }
             row_acc.next_row();
         }
@@ -53,6 +81,50 @@ void for_each_pixel_( const Image_Base<ImageT>&         image_,
     progress.report_finished();
 }
 
+/// Apply a functor to each pixel of an image which can report empty regions, one
+/// block at a time.  Empty blocks pass the fill pixel to the functor without reading
+/// the image, and other blocks are rasterized once rather than read pixel-by-pixel.
+///
+/// Pixels are visited block by block, and plane by plane within each block, rather
+/// than in plane-major raster order, so the functor must not depend on visit order.
+template <typename ImageT,
+          typename FunctorT>
+void for_each_pixel_blocks_( const Image_Base<ImageT>&         image_,
+                             FunctorT&                         func,
+                             core::utility::Progress_Callback& progress )
+{
+    const ImageT& image = image_.impl();
+    const int rows = image.rows();
+    const int cols = image.cols();
+    const auto block_size = image.block_size();
+    const auto fill = image.fill_pixel();
+
+    core::utility::Progress_Callback_Null block_progress;
+    for( int j = 0; j < rows; j += block_size.height() )
+    {
+        progress.report_fractional_progress( j, rows );
+        for( int i = 0; i < cols; i += block_size.width() )
+        {
+            math::Rect2i bbox( math::ToPoint2<int>( i, j ),
+                               math::ToPoint2<int>( std::min( i + block_size.width(),  cols ),
+                                                    std::min( j + block_size.height(), rows ) ) );
+            if( image.is_empty( bbox ) )
+            {
+                for( size_t n = bbox.area() * image.planes(); n; --n )
+                {
+                    func( fill );
+                }
+                continue;
+            }
+
+            Image_Memory<typename ImageT::pixel_type> block( bbox.width(), bbox.height(), image.planes() );
+            image.rasterize( block, bbox );
+            for_each_pixel_( block, func, block_progress );
+        }
+    }
+    progress.report_finished();
+}
+
 /// Overload with default no progress callback.
 template <typename ImageT,
           typename FunctorT>
@@ -60,6 +132,14 @@ void for_each_pixel( const Image_Base<ImageT>&         image,
                      FunctorT&                         func,
                      core::utility::Progress_Callback& progress )
 {
+    if constexpr( Has_Empty_Regions<ImageT>::value::value )
+    {
+        if( image.impl().has_empty_regions() )
+        {
+            for_each_pixel_blocks_<ImageT,FunctorT>( image, func, progress );
+            return;
+        }
+    }
     for_each_pixel_<ImageT,FunctorT>( image, func, progress );
 }
 
@@ -70,6 +150,14 @@ void for_each_pixel( const Image_Base<ImageT>&               image,
                      const FunctorT&                         func,
                      const core::utility::Progress_Callback& progress )
 {
+    if constexpr( Has_Empty_Regions<ImageT>::value::value )
+    {
+        if( image.impl().has_empty_regions() )
+        {
+            for_each_pixel_blocks_<ImageT,const FunctorT>( image, func, progress );
+            return;
+        }
+    }
     for_each_pixel_<ImageT,const FunctorT>( image, func, progress );
 }
 
@@ -0,0 +1,192 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_allocator.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/log/utility.hpp>
+
+// C++ Libraries
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+// System Libraries
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace tmns::image {
+
+/**
+ * How large pixel buffers are placed in memory.
+ *
+ * Buffers below `min_bytes` always come from the regular heap.  Larger buffers are
+ * mapped directly, so the options below can be applied to them.  Mapped pages are
+ * not touched by the allocating thread, so on NUMA machines each page lands on the
+ * node of the worker that first writes it (first-touch), unless interleaving is set.
+*/
+struct Allocation_Policy
+{
+    /// Ask for transparent huge pages, cutting TLB misses on full-image scans
+    bool huge_pages { false };
+
+    /// Try explicit huge pages from the hugetlb pool first.  Falls back when none are reserved.
+    bool hugetlb { false };
+
+    /// Spread the pages across every allowed NUMA node
+    bool interleave { false };
+
+    /// Smallest buffer the policy applies to
+    size_t min_bytes { 2 * 1024 * 1024 };
+
+    /**
+     * Check if no placement option is set, so buffers come from the heap
+    */
+    bool is_default() const
+    {
+        return !huge_pages && !hugetlb && !interleave;
+    }
+
+}; // End of Allocation_Policy struct
+
+namespace impl {
+
+/**
+ * Process-wide policy given to new images
+*/
+inline Allocation_Policy& default_allocation_policy_storage()
+{
+    static Allocation_Policy policy;
+    return policy;
+}
+
+/**
+ * Check if a default-constructed pixel is all zero bytes, so fresh anonymous
+ * pages can stand in for constructed pixels
+*/
+template <typename PixelT>
+bool default_is_zero()
+{
+    static const bool result = []() {
+        const PixelT pixel {};
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>( &pixel );
+        for( size_t i = 0; i < sizeof( PixelT ); ++i )
+        {
+            if( bytes[i] != 0 )
+            {
+                return false;
+            }
+        }
+        return true;
+    }();
+    return result;
+}
+
+/**
+ * Interleave a mapping across the NUMA nodes this process may use.  Called through
+ * syscall() so there is no dependency on libnuma.  Failure leaves the default policy.
+*/
+inline void interleave_pages( void* addr, size_t num_bytes )
+{
+    static constexpr unsigned long MAX_NODES = 1024;
+    unsigned long nodemask[MAX_NODES / ( 8 * sizeof( unsigned long ) )] {};
+
+    if( ::syscall( SYS_get_mempolicy, nullptr, nodemask, MAX_NODES, nullptr, MPOL_F_MEMS_ALLOWED ) != 0 ||
+        ::syscall( SYS_mbind, addr, num_bytes, MPOL_INTERLEAVE, nodemask, MAX_NODES, 0 ) != 0 )
+    {
+        tmns::log::debug( "Unable to interleave image buffer: ", std::strerror( errno ) );
+    }
+}
+
+} // End of impl namespace
+
+/**
+ * Get the policy new images are created with
+*/
+inline Allocation_Policy default_allocation_policy()
+{
+    return impl::default_allocation_policy_storage();
+}
+
+/**
+ * Set the policy new images are created with.  Call before starting worker threads.
+*/
+inline void set_default_allocation_policy( const Allocation_Policy& policy )
+{
+    impl::default_allocation_policy_storage() = policy;
+}
+
+/**
+ * Allocate default-constructed pixels following the policy
+ *
+ * @param num_pixels Number of pixels
+ * @param policy Placement options
+ * @returns Null pointer if the memory is not available
+*/
+template <typename PixelT>
+std::shared_ptr<PixelT[]> allocate_pixels( size_t                   num_pixels,
+                                           const Allocation_Policy& policy )
+{
+    const size_t num_bytes = num_pixels * sizeof( PixelT );
+    if constexpr( std::is_trivially_destructible_v<PixelT> )
+    {
+        if( !policy.is_default() && num_bytes >= policy.min_bytes )
+        {
+            static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+            const size_t map_bytes = ( num_bytes + HUGE_PAGE_SIZE - 1 ) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+            void* addr = MAP_FAILED;
+            if( policy.hugetlb )
+            {
+                addr = ::mmap( nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+            }
+            if( addr == MAP_FAILED )
+            {
+                addr = ::mmap( nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+                if( addr == MAP_FAILED )
+                {
+                    return nullptr;
+                }
+                if( policy.huge_pages )
+                {
+                    ::madvise( addr, map_bytes, MADV_HUGEPAGE );
+                }
+            }
+
+            // Must happen before any page is touched
+            if( policy.interleave )
+            {
+                impl::interleave_pages( addr, map_bytes );
+            }
+
+            PixelT* pixels = static_cast<PixelT*>( addr );
+            if( !impl::default_is_zero<PixelT>() )
+            {
+                std::uninitialized_value_construct_n( pixels, num_pixels );
+            }
+            return std::shared_ptr<PixelT[]>( pixels,
+                                              [map_bytes]( PixelT* ptr ){ ::munmap( ptr, map_bytes ); } );
+        }
+    }
+    return std::shared_ptr<PixelT[]>( new (std::nothrow) PixelT[num_pixels] );
+}
+
+} // End of tmns::image namespace
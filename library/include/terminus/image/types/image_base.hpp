@@ -15,16 +15,20 @@
 #pragma once
 
 // Terminus Image Libraries
-#include <terminus/feature/interest_point.hpp>
-#include <terminus/image/metadata/metadata_container_base.hpp>
 #include <terminus/image/pixel/channel_type_id.hpp>
 #include <terminus/image/pixel/pixel_format_id.hpp>
 #include <terminus/image/types/image_format.hpp>
+#include <terminus/image/types/image_payload.hpp>
 #include <terminus/image/types/pixel_iterator.hpp>
 
 // Terminus Libraries
 #include <terminus/math/Rectangle.hpp>
 
+// C++ Libraries
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
 namespace tmns::image {
 
 /**
@@ -146,7 +150,7 @@ class Image_Base
          */
         feature::Interest_Point_List const& interest_points() const
         {
-            return m_interest_points;
+            return payload().interest_points;
         }
 
         /**
@@ -154,7 +158,7 @@ class Image_Base
          */
         feature::Interest_Point_List& interest_points()
         {
-            return m_interest_points;
+            return payload().interest_points;
         }
 
         /**
@@ -162,18 +166,42 @@ class Image_Base
          */
         meta::Metadata_Container_Base::ptr_t metadata() const
         {
-            return m_metadata;
+            return payload().metadata;
+        }
+
+        /**
+         * Check if metadata or interest points have been attached
+        */
+        bool has_payload() const
+        {
+            return m_payload.load( std::memory_order_acquire ) != nullptr;
         }
 
         /**
          * Copy all non-pixel data.  As this capability grows, just put it all
          * here so the dozen or so View-Types don't have to overthink it.
+         *
+         * The metadata container is shared, not copied.
          */
         template <typename ImageT>
         void copy_payload_data( const ImageT& rhs )
         {
-            interest_points() = rhs.interest_points();
-            metadata()        = rhs.metadata();
+            if constexpr( std::is_base_of_v<Image_Base<ImageT>,ImageT> )
+            {
+                // Images with their own metadata accessor, such as Image_Disk merging the
+                // resource metadata on first access, may have none attached until asked
+                constexpr bool own_metadata = !std::is_same_v<decltype( &ImageT::metadata ),
+                                                              decltype( &Image_Base<ImageT>::metadata )>;
+
+                // Nothing attached to the source, so drop ours as well
+                if( !own_metadata && !rhs.has_payload() )
+                {
+                    delete m_payload.exchange( nullptr, std::memory_order_acq_rel );
+                    return;
+                }
+            }
+            payload().metadata        = rhs.metadata();
+            payload().interest_points = rhs.interest_points();
         }
 
         /**
@@ -194,18 +222,72 @@ class Image_Base
         /// The user can't be allowed to use these
         Image_Base() = default;
 
-        Image_Base( const Image_Base& rhs ) = default;
+        /**
+         * Copy Constructor.  Pure views have no payload, so copying them allocates nothing.
+        */
+        Image_Base( const Image_Base& rhs )
+        {
+            if( auto* other = rhs.m_payload.load( std::memory_order_acquire ) )
+            {
+                m_payload.store( new Image_Payload( *other ), std::memory_order_release );
+            }
+        }
+
+        /**
+         * Move Constructor.  Takes the payload without copying it.
+        */
+        Image_Base( Image_Base&& rhs ) noexcept
+          : m_payload( rhs.m_payload.exchange( nullptr, std::memory_order_acq_rel ) )
+        {
+        }
 
         Image_Base& operator = ( [[maybe_unused]] const Image_Base& rhs )
         {
             return (*this);
         }
 
-        /// List of feature points
-        feature::Interest_Point_List m_interest_points;
+        /**
+         * Take the payload from another image, dropping ours
+        */
+        void move_payload_data( Image_Base& rhs )
+        {
+            delete m_payload.exchange( rhs.m_payload.exchange( nullptr, std::memory_order_acq_rel ),
+                                       std::memory_order_acq_rel );
+        }
+
+        /**
+         * Destructor
+        */
+        ~Image_Base()
+        {
+            delete m_payload.load( std::memory_order_acquire );
+        }
+
+        /**
+         * Get the payload, creating it on first use.  Safe to race from several threads,
+         * as only one of the created payloads is kept.
+        */
+        Image_Payload& payload() const
+        {
+            auto* current = m_payload.load( std::memory_order_acquire );
+            if( !current )
+            {
+                auto created = std::make_unique<Image_Payload>();
+                if( m_payload.compare_exchange_strong( current,
+                                                       created.get(),
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_acquire ) )
+                {
+                    current = created.release();
+                }
+            }
+            return *current;
+        }
+
+    private:
 
-        /// Image Metadata
-        meta::Metadata_Container_Base::ptr_t m_metadata { std::make_shared<meta::Metadata_Container_Base>() };
+        /// Metadata and interest points, created on first access
+        mutable std::atomic<Image_Payload*> m_payload { nullptr };
 
 }; // End of ImageBase Class
 
@@ -19,6 +19,7 @@
 
 // Terminus Libraries
 #include <terminus/image/types/image_format.hpp>
+#include <terminus/math/Rectangle.hpp>
 
 namespace tmns::image {
 
@@ -117,6 +118,17 @@ class Image_Buffer
         */
         void set_pstride( ssize_t value );
 
+        /**
+         * Get a buffer referencing a sub-region of this one.  No data is copied;
+         * the result shares this buffer's strides.
+        */
+        Image_Buffer cropped( const math::Rect2i& bbox ) const;
+
+        /**
+         * Get a buffer referencing a single plane of this one.
+        */
+        Image_Buffer plane( int plane ) const;
+
         /**
          * Get the point at a specific pixel
         */
@@ -155,15 +167,6 @@ class Image_Buffer
     return planes() * pstride;
     }
 
-    /// Returns a cropped version of this bufffer.
-    inline ImageBuffer cropped( BBox2i const& bbox ) const {
-    ImageBuffer self = *this;
-    self.data = (uint8*)self.data + cstride*bbox.min().x() + rstride*bbox.min().y();
-    self.format.cols = bbox.width();
-    self.format.rows = bbox.height();
-    return self;
-    }
-
     /// Read the image resource at the given location into the given buffer.
     /// - Though the ImageBuffer object is const, the contents of the buffer will change!
     inline void read( ImageBuffer const& buf, BBox2i const& bbox ) const {
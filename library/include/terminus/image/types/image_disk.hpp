@@ -21,6 +21,10 @@
 #include "Image_Resource_Base.hpp"
 #include "Image_Resource_View.hpp"
 
+// C++ Libraries
+#include <memory>
+#include <mutex>
+
 namespace tmns::image {
 
 /**
@@ -55,8 +59,6 @@ class Image_Disk : public Image_Base<Image_Disk<PixelT>>
                     1,
                     cache )
         {
-            this->metadata()->insert( resource->metadata(),
-                                      true );
         }
 
         /**
@@ -64,6 +66,18 @@ class Image_Disk : public Image_Base<Image_Disk<PixelT>>
         */
         ~Image_Disk() = default;
 
+        /**
+         * Get the metadata.  The resource metadata is merged in on the first call.
+        */
+        meta::Metadata_Container_Base::ptr_t metadata() const
+        {
+            std::call_once( *m_metadata_merged, [this]() {
+                base_type::metadata()->insert( m_resource->metadata(),
+                                               true );
+            });
+            return base_type::metadata();
+        }
+
         /**
          * Get the number of columns
          */
@@ -125,6 +139,38 @@ class Image_Disk : public Image_Base<Image_Disk<PixelT>>
             tmns::log::trace( LOG_IMAGE_TAG(), "end of rasterize" );
         }
 
+        /**
+         * Check if the resource can report regions holding no data
+        */
+        bool has_empty_regions() const
+        {
+            return m_impl.has_empty_regions();
+        }
+
+        /**
+         * Check if the resource reports the region as holding no data
+        */
+        bool is_empty( const math::Rect2i& bbox ) const
+        {
+            return m_impl.is_empty( bbox );
+        }
+
+        /**
+         * Value of every pixel in an empty region
+        */
+        pixel_type fill_pixel() const
+        {
+            return m_impl.fill_pixel();
+        }
+
+        /**
+         * Get the block size used for processing
+        */
+        math::Size2i block_size() const
+        {
+            return m_impl.block_size();
+        }
+
         /**
          * Get the image filename
         */
@@ -154,6 +200,9 @@ class Image_Disk : public Image_Base<Image_Disk<PixelT>>
         /// Underlying block resource
         impl_type m_impl;
 
+        /// Guards the one-time merge of the resource metadata.  Shared by copies, as is the container.
+        std::shared_ptr<std::once_flag> m_metadata_merged { std::make_shared<std::once_flag>() };
+
 
 }; // End of Image_Disk Class
 
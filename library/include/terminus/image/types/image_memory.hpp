@@ -20,13 +20,16 @@
 // Terminus Image Libraries
 #include <terminus/image/operations/rasterize.hpp>
 #include <terminus/image/pixel/pixel_accessor_memstride.hpp>
+#include <terminus/image/types/image_allocator.hpp>
 #include <terminus/image/types/image_base.hpp>
 #include <terminus/image/types/image_buffer.hpp>
 #include <terminus/image/types/image_resource_base.hpp>
 #include <terminus/image/types/image_traits.hpp>
 
 // C++ Libraries
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 
 namespace tmns::image {
 
@@ -64,6 +67,10 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
          * Does a weak copy, which effectively transfers pointers
          * and info over.  Do not manually destruct the other
          * Image_Memory instance's pixel data.
+         *
+         * Views rely on this to write into their parent image.  Call detach()
+         * before writing into an image received by value, or deep_copy() for
+         * an independent image up front.
          */
         Image_Memory( const Image_Memory& rhs )
          : Image_Base<Image_Memory<PixelT>>( rhs ),
@@ -73,9 +80,68 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
            m_planes( rhs.m_planes ),
            m_origin( rhs.m_origin ),
            m_rstride( rhs.m_rstride ),
-           m_pstride( rhs.m_pstride )
+           m_pstride( rhs.m_pstride ),
+           m_policy( rhs.m_policy )
         {}
 
+        /**
+         * Move-Constructor.  Leaves the other image empty.
+        */
+        Image_Memory( Image_Memory&& rhs ) noexcept
+         : Image_Base<Image_Memory<PixelT>>( std::move( rhs ) ),
+           m_data( std::move( rhs.m_data ) ),
+           m_cols( rhs.m_cols ),
+           m_rows( rhs.m_rows ),
+           m_planes( rhs.m_planes ),
+           m_origin( rhs.m_origin ),
+           m_rstride( rhs.m_rstride ),
+           m_pstride( rhs.m_pstride ),
+           m_policy( rhs.m_policy )
+        {
+            rhs.reset();
+        }
+
+        /**
+         * Copy-Assignment.  Shares the pixels, as the copy-constructor does.
+        */
+        Image_Memory& operator = ( const Image_Memory& rhs )
+        {
+            if( this != &rhs )
+            {
+                m_data    = rhs.m_data;
+                m_cols    = rhs.m_cols;
+                m_rows    = rhs.m_rows;
+                m_planes  = rhs.m_planes;
+                m_origin  = rhs.m_origin;
+                m_rstride = rhs.m_rstride;
+                m_pstride = rhs.m_pstride;
+                m_policy  = rhs.m_policy;
+                this->copy_payload_data( rhs );
+            }
+            return *this;
+        }
+
+        /**
+         * Move-Assignment.  Leaves the other image empty.
+        */
+        Image_Memory& operator = ( Image_Memory&& rhs ) noexcept
+        {
+            if( this != &rhs )
+            {
+                m_data    = std::move( rhs.m_data );
+                m_cols    = rhs.m_cols;
+                m_rows    = rhs.m_rows;
+                m_planes  = rhs.m_planes;
+                m_origin  = rhs.m_origin;
+                m_rstride = rhs.m_rstride;
+                m_pstride = rhs.m_pstride;
+                m_policy  = rhs.m_policy;
+                this->move_payload_data( rhs );
+                rhs.reset();
+            }
+            return *this;
+        }
+
         /**
          * Build an empty image with the default dimensions.
          * Note we set the sizes initially to zero so the `set_size()`
@@ -87,6 +153,18 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             set_size( cols, rows, planes );
         }
 
+        /**
+         * Build an empty image, placing the pixels according to the policy.
+         */
+        Image_Memory( size_t                   cols,
+                      size_t                   rows,
+                      size_t                   planes,
+                      const Allocation_Policy& policy )
+          : m_policy( policy )
+        {
+            set_size( cols, rows, planes );
+        }
+
         /**
          * Build the Image from any other "Image Type". Note this
          * comes after the Copy-Constructor above so if doing an
@@ -142,10 +220,18 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
         /**
          * Rasterizes the input view into the image, adjusting size and
          * copying data as needed.  This returns itself.
+         *
+         * Pixels shared with another image are released first, so the
+         * rasterized data does not show up in the other image.
          */
         template <typename InputImageT>
         const Image_Memory& operator = ( const Image_Base<InputImageT>& input_image )
         {
+            // Every pixel is overwritten, so take fresh storage rather than copying
+            if( !unique() )
+            {
+                reset();
+            }
             set_size( input_image.impl().cols(),
                       input_image.impl().rows(),
                       input_image.impl().planes() );
@@ -169,7 +255,7 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
                                           input_image.full_bbox() );
 
             // Transfer other components
-            this->m_interest_points = input_image.m_interest_point;
+            this->payload().interest_points = input_image.impl().interest_points();
 
             return *this;
         }
@@ -222,11 +308,11 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
          */
         Image_Buffer buffer() const
         {
-            Image_Buffer buffer( data(),
+            Image_Buffer buffer( m_origin,
                                  base_type::format(),
                                  sizeof(PixelT),
-                                 sizeof(PixelT) * cols(),
-                                 sizeof(PixelT) * cols() * rows() );
+                                 sizeof(PixelT) * m_rstride,
+                                 sizeof(PixelT) * m_pstride );
             return buffer;
         }
 
@@ -291,7 +377,7 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             else
             {
                 // I like this catch because we can wrap the result and not throw
-                std::shared_ptr<PixelT[]> data( new (std::nothrow) PixelT[num_pixels] );
+                std::shared_ptr<PixelT[]> data = allocate_pixels<PixelT>( num_pixels, m_policy );
 
                 if( !data )
                 {
@@ -315,6 +401,22 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
             return outcome::ok();
         }
 
+        /**
+         * Get the policy used to place the pixels
+        */
+        const Allocation_Policy& allocation_policy() const
+        {
+            return m_policy;
+        }
+
+        /**
+         * Set the policy used to place the pixels.  Applies to the next allocation.
+        */
+        void set_allocation_policy( const Allocation_Policy& policy )
+        {
+            m_policy = policy;
+        }
+
         void reset()
         {
             m_data.reset();
@@ -339,7 +441,56 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
         */
         bool unique() const
         {
-            return (!m_data) || m_data.unique();
+            return (!m_data) || m_data.use_count() == 1;
+        }
+
+        /**
+         * Copy-on-write.  Take a private copy of the pixels only if another image
+         * or view shares them, so writes after this stay local.
+        */
+        Result<void> detach()
+        {
+            if( unique() )
+            {
+                return outcome::ok();
+            }
+
+            const size_t num_pixels = m_cols * m_rows * m_planes;
+            std::shared_ptr<PixelT[]> data = allocate_pixels<PixelT>( num_pixels, m_policy );
+            if( !data )
+            {
+                std::stringstream sout;
+                sout << "Cannot allocate enough memory to copy a " << m_cols << " x "
+                     << m_rows << " x " << m_planes << " image.";
+                return outcome::fail( error::Error_Code::OUT_OF_MEMORY,
+                                      sout.str() );
+            }
+            std::copy( m_origin, m_origin + num_pixels, data.get() );
+
+            m_data   = data;
+            m_origin = m_data.get();
+            return outcome::ok();
+        }
+
+        /**
+         * Create an image with its own copy of the pixels and payload
+        */
+        Image_Memory deep_copy() const
+        {
+            Image_Memory result( *this );
+            auto detach_res = result.detach();
+            if( detach_res.has_error() )
+            {
+                throw std::runtime_error( detach_res.error().message() );
+            }
+
+            // The copy constructor shares the metadata container, so give the copy its own
+            if( this->has_payload() )
+            {
+                result.payload().metadata = std::make_shared<meta::Metadata_Container_Base>();
+                result.payload().metadata->insert( this->metadata(), true );
+            }
+            return result;
         }
 
         /**
@@ -391,6 +542,9 @@ class Image_Memory : public Image_Base<Image_Memory<PixelT>>
         size_t m_rstride { 0 };
         size_t m_pstride { 0 };
 
+        /// Placement of large pixel buffers
+        Allocation_Policy m_policy { default_allocation_policy() };
+
 }; // End of Image_Memory Class
 
 template <typename PixelT>
@@ -412,5 +566,12 @@ struct Is_Multiply_Accessible<Image_Memory<PixelT>>
     typedef std::true_type value;
 };
 
+/// Specifies that ImageView objects can be handed to resources as a buffer.
+template <class PixelT>
+struct Is_Memory_Buffered<Image_Memory<PixelT>>
+{
+    typedef std::true_type value;
+};
+
 
 } // End of tmns::image namespace
\ No newline at end of file
@@ -0,0 +1,39 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_payload.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Image Libraries
+#include <terminus/feature/interest_point.hpp>
+#include <terminus/image/metadata/metadata_container_base.hpp>
+
+namespace tmns::image {
+
+/**
+ * Non-pixel data attached to an image, such as metadata and interest points.
+ *
+ * Images only create this on first access.  Views made while rasterizing never
+ * touch it, so they stay cheap to build and copy.
+*/
+struct Image_Payload
+{
+    /// List of feature points
+    feature::Interest_Point_List interest_points;
+
+    /// Image Metadata
+    meta::Metadata_Container_Base::ptr_t metadata { std::make_shared<meta::Metadata_Container_Base>() };
+
+}; // End of Image_Payload struct
+
+} // End of tmns::image namespace
@@ -27,19 +27,27 @@
 #include <terminus/image/types/image_format.hpp>
 
 // C++ Libraries
+#include <future>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace tmns::image {
 
 /**
  * Base-type for resources which read data from a source.
 */
-class Read_Image_Resource_Base
+class Read_Image_Resource_Base : public std::enable_shared_from_this<Read_Image_Resource_Base>
 {
     public:
 
         typedef std::shared_ptr<Read_Image_Resource_Base> ptr_t;
 
+        /**
+         * Constructor
+        */
+        Read_Image_Resource_Base();
+
         virtual ~Read_Image_Resource_Base() = default;
 
         /**
@@ -88,6 +96,63 @@ class Read_Image_Resource_Base
         virtual Result<void> read( const Image_Buffer& dest,
                                    const math::Rect2i& bbox ) const = 0;
 
+        /**
+         * Read the image data without waiting for it.
+         *
+         * Resources owned by a shared_ptr are kept alive until the read finishes.  Others
+         * must outlive the returned future.  The destination buffer must always outlive it.
+        */
+        virtual std::future<Result<void>> read_async( const Image_Buffer& dest,
+                                                      const math::Rect2i& bbox ) const;
+
+        /**
+         * Queue a batch of reads in a single submission.  Reads are serviced in order
+         * by the shared Async_Read_Queue.  Unless has_concurrent_read() is true, reads of
+         * this resource run one at a time, on whichever I/O thread drains its queue.
+         *
+         * Resources owned by a shared_ptr are kept alive until the reads finish.  Others
+         * must outlive the returned futures.  The destination buffers must always outlive them.
+         *
+         * @return One future per destination, in the same order
+        */
+        virtual std::vector<std::future<Result<void>>> read_async( const std::vector<Image_Buffer>& dests,
+                                                                   const std::vector<math::Rect2i>& bboxes ) const;
+
+        /**
+         * Hint that a region will be read soon, so the resource can start fetching it
+         * from the device.  Returns without waiting.  The default does nothing.
+        */
+        virtual void prefetch( const math::Rect2i& bbox ) const;
+
+        /**
+         * Read many regions at once.
+         *
+         * Overlapping or adjacent regions whose destinations share a format are merged
+         * into a single read, aligned to block_read_size() when the resource supports
+         * block reads, so each native block is read once and scattered to every
+         * destination which needs it.
+         *
+         * @param bboxes Regions to read
+         * @param dests Destination for each region
+        */
+        virtual Result<void> read_many( std::span<const math::Rect2i> bboxes,
+                                        std::span<const Image_Buffer> dests ) const;
+
+        /**
+         * Read a single block, where blocks tile the image at block_read_size().
+         * Blocks on the right and bottom edges are clipped to the image, so
+         * @p dest must match the clipped size.
+         *
+         * Resources with native tiles override this to decode the tile directly.
+         *
+         * @param ix Block column
+         * @param iy Block row
+         * @param dest Destination buffer
+        */
+        virtual Result<void> read_block( int                 ix,
+                                         int                 iy,
+                                         const Image_Buffer& dest ) const;
+
         /**
          * Check if the resource supports block reads.
          */
@@ -98,6 +163,12 @@ class Read_Image_Resource_Base
          */
         virtual math::Size2i block_read_size() const;
 
+        /**
+         * Check if read() may be called from several threads at once.  Callers
+         * must serialize reads of resources which return false.
+        */
+        virtual bool has_concurrent_read() const;
+
         /**
          * Check if the resource supports nodata values for the loaded file.
         */
@@ -108,6 +179,27 @@ class Read_Image_Resource_Base
          */
         virtual double nodata_read() const;
 
+        /**
+         * Check if a region holds no data, such as sparse tiles which were never
+         * written to the file.  Empty regions read back as nodata_read() if the
+         * resource has a nodata value, otherwise as zero.
+         *
+         * Resources which cannot tell always return false.
+        */
+        virtual bool is_empty( const math::Rect2i& bbox ) const;
+
+        /**
+         * Check if is_empty() can ever return true for this resource.  Callers
+         * use this to skip per-block emptiness checks on resources that cannot tell.
+        */
+        virtual bool has_empty_regions() const;
+
+        /**
+         * Fill a destination with the value empty regions read back as, converted
+         * the same way read() converts the resource data.
+        */
+        virtual Result<void> read_fill( const Image_Buffer& dest ) const;
+
         /// Return a pointer to the data in the same format as format(). This
         /// might cause a copy, depending on implementation. The shared_ptr will
         /// handle cleanup.
@@ -118,6 +210,26 @@ class Read_Image_Resource_Base
         */
         virtual size_t native_size() const;
 
+    protected:
+
+        /**
+         * Build a buffer in format() holding nodata_read(), or zero if there is no
+         * nodata value, then convert it into the destination like read() does.
+         *
+         * @param dest Destination to fill
+         * @param rescale Flag if we need to scale imagery
+        */
+        Result<void> convert_fill( const Image_Buffer& dest,
+                                   bool                rescale ) const;
+
+    private:
+
+        /// Queue of asynchronous reads which must not overlap
+        struct Read_Strand;
+
+        /// Serializes asynchronous reads.  Shared by copies of the resource.
+        std::shared_ptr<Read_Strand> m_read_strand;
+
 }; // End of Read_Image_Resource_Base Class
 
 class Write_Image_Resource_Base
@@ -177,9 +289,9 @@ class Image_Resource_Base : public Read_Image_Resource_Base,
         typedef std::shared_ptr<Image_Resource_Base> ptr_t;
 
         /**
-         * @brief Get the internal metadata container
+         * @brief Get the internal metadata container.  Drivers may populate it on first access.
          */
-        meta::Metadata_Container_Base::ptr_t metadata() const
+        virtual meta::Metadata_Container_Base::ptr_t metadata() const
         {
             return m_metadata;
         }
@@ -27,6 +27,12 @@
 #include <terminus/math/types/Fundamental_Types.hpp>
 #include <terminus/outcome/Result.hpp>
 
+// C++ Libraries
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 namespace tmns::image {
 
 /**
@@ -59,6 +65,7 @@ class Image_Resource_View : public Image_Base<Image_Resource_View<PixelT>>
         */
         Image_Resource_View( Read_Image_Resource_Base::ptr_t resource )
           : m_resource( resource ),
+            m_concurrent_read( m_resource->has_concurrent_read() ),
             m_planes( m_resource->planes() )
         {
             m_constructor_status = initialize();
@@ -94,19 +101,48 @@ class Image_Resource_View : public Image_Base<Image_Resource_View<PixelT>>
 
         /**
          * Return the pixel at the specified location.
-         * @note:  This is a slow process and should not be used.
+         *
+         * The tile holding the pixel is read and kept, so walking the view pixel by
+         * pixel costs one read per tile.  Use rasterize() for large regions.
         */
         result_type operator() ( int x, int y, int plane = 0 ) const
         {
-            // Lock the mutex
-            core::conc::Mutex::Lock lck( m_resource_mtx );
+            const math::Size2i tile = tile_size();
+            const int tile_x = x / tile.width();
+            const int tile_y = y / tile.height();
+
+            core::conc::Mutex::Lock lck( m_tile_cache->mutex );
+
+            auto& tiles = m_tile_cache->tiles;
+            for( auto it = tiles.begin(); it != tiles.end(); ++it )
+            {
+                if( it->first.x() == tile_x && it->first.y() == tile_y )
+                {
+                    // Keep the most recent tile at the front
+                    tiles.splice( tiles.begin(), tiles, it );
+                    return it->second( x - tile_x * tile.width(),
+                                       y - tile_y * tile.height(),
+                                       plane );
+                }
+            }
+
+            // Read the whole tile
+            auto bbox = math::Rect2i::intersection( math::Rect2i( tile_x * tile.width(),
+                                                                  tile_y * tile.height(),
+                                                                  tile.width(),
+                                                                  tile.height() ),
+                                                    this->full_bbox() );
+            Image_Memory<PixelT> tile_image( bbox.width(), bbox.height(), m_planes );
+            this->rasterize( tile_image, bbox );
 
-            // Create output image memory object
-            Image_Memory<PixelT> dest_image( 1, 1, m_planes );
-            io::read_image( dest_image, 
-                            m_resource,
-                            math::Rect2i( x, y, 1, 1 ) );
-            return dest_image( 0, 0, plane );
+            tiles.emplace_front( math::Point2i( { tile_x, tile_y } ), tile_image );
+            if( tiles.size() > TILE_CACHE_SIZE )
+            {
+                tiles.pop_back();
+            }
+            return tile_image( x - bbox.min().x(),
+                               y - bbox.min().y(),
+                               plane );
         }
 
         /**
@@ -125,6 +161,59 @@ class Image_Resource_View : public Image_Base<Image_Resource_View<PixelT>>
             return dynamic_cast<const Image_Resource_Base*>( m_resource.get() );
         }
 
+        /**
+         * Hint that a region will be rasterized soon
+        */
+        void prefetch( const math::Rect2i& bbox ) const
+        {
+            m_resource->prefetch( bbox );
+        }
+
+        /**
+         * Check if the resource can report regions holding no data
+        */
+        bool has_empty_regions() const
+        {
+            return m_resource->has_empty_regions();
+        }
+
+        /**
+         * Check if the resource reports the region as holding no data
+        */
+        bool is_empty( const math::Rect2i& bbox ) const
+        {
+            return m_resource->is_empty( bbox );
+        }
+
+        /**
+         * Value of every pixel in an empty region.  This is the nodata value if the
+         * resource has one, otherwise zero, converted as rasterize() would convert it.
+        */
+        pixel_type fill_pixel() const
+        {
+            Image_Memory<PixelT> fill( 1, 1, m_planes );
+            auto result = m_resource->read_fill( fill.buffer() );
+            if( result.has_error() )
+            {
+                tmns::log::warn( "Unable to convert the fill value: ", result.error().message() );
+                return pixel_type {};
+            }
+            return fill( 0, 0 );
+        }
+
+        /**
+         * Block size which empty regions are aligned to.  This is the native
+         * block size of the resource, or a single row if it has none.
+        */
+        math::Size2i block_size() const
+        {
+            if( m_resource->has_block_read() )
+            {
+                return m_resource->block_read_size();
+            }
+            return math::Size2i( { (int)cols(), 1 } );
+        }
+
         /**
          * Pre-Rasterize
         */
@@ -148,13 +237,59 @@ class Image_Resource_View : public Image_Base<Image_Resource_View<PixelT>>
         void rasterize( const DestT&         dest,
                         const math::Rect2i&  bbox ) const
         {
+            // Thread-safe drivers let workers read disjoint regions in parallel
+            if( m_concurrent_read )
+            {
+                io::read_image( dest, m_resource, bbox );
+                return;
+            }
+
             core::conc::Mutex::Lock lock( m_resource_mtx );
-            //m_resource->read( dest.buffer(), bbox );
             io::read_image( dest, m_resource, bbox );
         }
 
+        /**
+         * Check if rasterize() may run on several threads at once without serializing
+        */
+        bool has_concurrent_read() const
+        {
+            return m_concurrent_read;
+        }
+
     private:
 
+        /// Tiles kept for pixel access.  Four covers a neighborhood straddling a tile corner.
+        static constexpr size_t TILE_CACHE_SIZE = 4;
+
+        /// Tile size used when the resource has no native block size
+        static constexpr int DEFAULT_TILE_SIZE = 256;
+
+        /**
+         * Recently read tiles, most recent first.  Shared by copies of the view.
+        */
+        struct Tile_Cache
+        {
+            core::conc::Mutex mutex;
+            std::list<std::pair<math::Point2i,Image_Memory<PixelT>>> tiles;
+        }; // End of Tile_Cache struct
+
+        /**
+         * Size of the tiles read for pixel access.  This is the native block size of
+         * the resource, so each tile costs a single decode.
+        */
+        math::Size2i tile_size() const
+        {
+            if( m_resource->has_block_read() )
+            {
+                auto size = m_resource->block_read_size();
+                if( size.width() > 0 && size.height() > 0 )
+                {
+                    return size;
+                }
+            }
+            return math::Size2i( { DEFAULT_TILE_SIZE, DEFAULT_TILE_SIZE } );
+        }
+
         /**
          * Determine the number of planes for the image based on the
          * resource and your desired destination pixel type.
@@ -185,9 +320,15 @@ class Image_Resource_View : public Image_Base<Image_Resource_View<PixelT>>
         /// Image Resource Data
         Read_Image_Resource_Base::ptr_t m_resource;
 
-        /// Mutex lock for hitting the resource
+        /// Mutex lock for hitting the resource, if it needs one
         mutable core::conc::Mutex m_resource_mtx;
 
+        /// Flag if the resource can be read from several threads at once
+        bool m_concurrent_read { false };
+
+        /// Tiles read for pixel access
+        std::shared_ptr<Tile_Cache> m_tile_cache { std::make_shared<Tile_Cache>() };
+
         /// Number of image planes
         int m_planes { 0 };
 
@@ -0,0 +1,442 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_scratch.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/Point.hpp>
+
+// Terminus Image Libraries
+#include <terminus/image/operations/rasterize.hpp>
+#include <terminus/image/pixel/pixel_accessor_memstride.hpp>
+#include <terminus/image/types/image_base.hpp>
+#include <terminus/image/types/image_buffer.hpp>
+#include <terminus/image/types/image_traits.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// System Libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace tmns::image {
+
+/**
+ * Map a zero-filled scratch area of the given size, backed by a temporary file.
+ *
+ * The file is unlinked as soon as it is created, so it is removed once the
+ * mapping is released, even after a crash.  It is sized with ftruncate(), so it
+ * stays sparse and only pages which have been written take up disk space.
+ *
+ * @param num_bytes Size of the mapping
+ * @param directory Directory to create the file in
+*/
+inline Result<std::shared_ptr<uint8_t>> map_scratch_file( size_t                       num_bytes,
+                                                          const std::filesystem::path& directory )
+{
+    std::string pattern = ( directory / "terminus_scratch_XXXXXX" ).native();
+    std::vector<char> name( pattern.begin(), pattern.end() );
+    name.push_back( '\0' );
+
+    int fd = ::mkstemp( name.data() );
+    if( fd < 0 )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to create scratch file in ", directory.native(), ": ",
+                              std::strerror( errno ) );
+    }
+    ::unlink( name.data() );
+
+    if( ::ftruncate( fd, static_cast<off_t>( num_bytes ) ) != 0 )
+    {
+        ::close( fd );
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to size scratch file to ", num_bytes, " bytes: ",
+                              std::strerror( errno ) );
+    }
+
+    void* addr = ::mmap( nullptr,
+                         num_bytes,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_NORESERVE,
+                         fd,
+                         0 );
+    ::close( fd );
+    if( addr == MAP_FAILED )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to map scratch file of ", num_bytes, " bytes: ",
+                              std::strerror( errno ) );
+    }
+
+    return outcome::ok<std::shared_ptr<uint8_t>>( std::shared_ptr<uint8_t>( static_cast<uint8_t*>( addr ),
+                                                                            [num_bytes]( uint8_t* ptr ){ ::munmap( ptr, num_bytes ); } ) );
+}
+
+/**
+ * Image type for intermediate products larger than RAM.
+ *
+ * Same interface as Image_Memory, but the pixels live in a memory-mapped temporary
+ * file.  The kernel pages regions in as they are touched and writes them back under
+ * memory pressure, so pipelines spill to disk instead of failing to allocate.
+ * Pixels start out zeroed.
+*/
+template <typename PixelT>
+class Image_Scratch : public Image_Base<Image_Scratch<PixelT>>
+{
+    public:
+
+        static_assert( std::is_trivially_copyable_v<PixelT>,
+                       "Image_Scratch stores pixels in a file, so they must be trivially copyable" );
+
+        /// Pixel Type
+        typedef PixelT pixel_type;
+
+        /// Return type when you query actual data
+        typedef PixelT& result_type;
+
+        /// Base type of the image
+        typedef Image_Base<Image_Scratch<PixelT>> base_type;
+
+        /// Prerasterize Type
+        typedef Image_Scratch prerasterize_type;
+
+        /// Accessor Type
+        typedef Pixel_Accessor_MemStride<PixelT> pixel_accessor;
+
+        /**
+         * Default Constructor.  Scratch files go in the system temporary directory.
+        */
+        Image_Scratch() = default;
+
+        /**
+         * Build an image of the given size
+         *
+         * @param directory Where to put the scratch file.  Pick a disk with room for the image.
+        */
+        Image_Scratch( size_t                       cols,
+                       size_t                       rows,
+                       size_t                       planes    = 1,
+                       const std::filesystem::path& directory = std::filesystem::temp_directory_path() )
+          : m_directory( directory )
+        {
+            auto result = set_size( cols, rows, planes );
+            if( result.has_error() )
+            {
+                throw std::runtime_error( result.error().message() );
+            }
+        }
+
+        /**
+         * Build the image from any other image type
+         *
+         * @param directory Where to put the scratch file.  Pick a disk with room for the image.
+        */
+        template <typename ImageT>
+        Image_Scratch( const Image_Base<ImageT>&    image,
+                       const std::filesystem::path& directory = std::filesystem::temp_directory_path() )
+          : Image_Scratch( image.impl().cols(),
+                           image.impl().rows(),
+                           image.impl().planes(),
+                           directory )
+        {
+            image.impl().rasterize( *this, image.impl().full_bbox() );
+        }
+
+        /**
+         * Rasterize another image into this one, resizing as needed
+        */
+        template <typename InputImageT>
+        const Image_Scratch& operator = ( const Image_Base<InputImageT>& input_image )
+        {
+            auto result = set_size( input_image.impl().cols(),
+                                    input_image.impl().rows(),
+                                    input_image.impl().planes() );
+            if( result.has_error() )
+            {
+                throw std::runtime_error( result.error().message() );
+            }
+
+            input_image.impl().rasterize( *this,
+                                          input_image.full_bbox() );
+
+            // Transfer other components
+            this->copy_payload_data( input_image.impl() );
+
+            return *this;
+        }
+
+        /**
+         * Get the number of rows in the image
+        */
+        size_t rows() const { return m_rows; }
+
+        /**
+         * Get the number of columns in the image
+         */
+        size_t cols() const { return m_cols; }
+
+        /**
+         * Get the number of planes in the image
+         */
+        size_t planes() const { return m_planes; }
+
+        /**
+         * Get the image origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( m_origin,
+                                   m_rstride,
+                                   m_pstride );
+        }
+
+        /**
+         * Return specific pixel position
+         */
+        result_type operator()( size_t col,
+                                size_t row,
+                                size_t plane = 0 ) const
+        {
+            return *( m_origin + col + row * m_rstride + plane * m_pstride );
+        }
+
+        /**
+         * Return specific pixel position
+         */
+        result_type operator()( const tmns::math::Point2i& loc,
+                                size_t                     plane = 0 ) const
+        {
+            return this->operator()( loc.x(), loc.y(), plane );
+        }
+
+        /**
+         * Returns an ImageBuffer describing the image data.
+         */
+        Image_Buffer buffer() const
+        {
+            return Image_Buffer( m_origin,
+                                 base_type::format(),
+                                 sizeof(PixelT),
+                                 sizeof(PixelT) * m_rstride,
+                                 sizeof(PixelT) * m_pstride );
+        }
+
+        /**
+         * Get a pointer to the top-left corner of the first channel.
+        */
+        pixel_type* data() const
+        {
+            return m_origin;
+        }
+
+        /**
+         * Resize the image, mapping a new scratch file if the size has changed.
+         * The old pixels are discarded.
+        */
+        Result<void> set_size( size_t cols,
+                               size_t rows,
+                               size_t planes = 1 )
+        {
+            if( cols == m_cols && rows == m_rows && planes == m_planes )
+            {
+                return outcome::ok();
+            }
+
+            const size_t num_pixels = cols * rows * planes;
+            if( cols != 0 && rows != 0 && planes != 0 &&
+                num_pixels / cols / rows != planes )
+            {
+                return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                                      "Image of ", cols, " x ", rows, " x ", planes,
+                                      " overflows the address space." );
+            }
+            if( num_pixels > std::numeric_limits<size_t>::max() / sizeof(PixelT) )
+            {
+                return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                                      "Image of ", cols, " x ", rows, " x ", planes,
+                                      " overflows the address space." );
+            }
+
+            if( num_pixels == 0 )
+            {
+                m_mapping.reset();
+            }
+            else
+            {
+                auto mapping = map_scratch_file( num_pixels * sizeof(PixelT), m_directory );
+                if( mapping.has_error() )
+                {
+                    return outcome::fail( mapping.error() );
+                }
+                m_mapping = mapping.value();
+            }
+
+            m_cols    = cols;
+            m_rows    = rows;
+            m_planes  = planes;
+            m_origin  = reinterpret_cast<PixelT*>( m_mapping.get() );
+            m_rstride = cols;
+            m_pstride = rows * cols;
+
+            return outcome::ok();
+        }
+
+        /**
+         * Release the scratch file
+        */
+        void reset()
+        {
+            m_mapping.reset();
+            m_cols    = 0;
+            m_rows    = 0;
+            m_planes  = 0;
+            m_origin  = nullptr;
+            m_rstride = 0;
+            m_pstride = 0;
+        }
+
+        /**
+         * Check if valid image
+        */
+        bool is_valid_image() const
+        {
+            return !(!m_mapping);
+        }
+
+        /**
+         * Check if anyone is sharing this
+        */
+        bool unique() const
+        {
+            return (!m_mapping) || m_mapping.use_count() == 1;
+        }
+
+        /**
+         * Ask the kernel to start paging in the rows covering a region
+        */
+        void prefetch( const math::Rect2i& bbox ) const
+        {
+            if( !m_mapping )
+            {
+                return;
+            }
+            const size_t row_begin = static_cast<size_t>( std::max( bbox.min().y(), 0 ) );
+            const size_t row_end   = std::min( static_cast<size_t>( std::max( bbox.max().y(), 0 ) ), m_rows );
+            if( row_begin >= row_end )
+            {
+                return;
+            }
+
+            const uintptr_t page = static_cast<uintptr_t>( ::sysconf( _SC_PAGESIZE ) );
+            for( size_t p = 0; p < m_planes; ++p )
+            {
+                auto first = reinterpret_cast<uintptr_t>( m_origin + row_begin * m_rstride + p * m_pstride );
+                auto last  = reinterpret_cast<uintptr_t>( m_origin + row_end   * m_rstride + p * m_pstride );
+                first &= ~( page - 1 );
+                ::madvise( reinterpret_cast<void*>( first ),
+                           static_cast<size_t>( last - first ),
+                           MADV_WILLNEED );
+            }
+        }
+
+        /**
+         * Prepare to be rasterized.  Pages in the region, then returns itself.
+        */
+        prerasterize_type prerasterize( const math::Rect2i& bbox ) const
+        {
+            prefetch( bbox );
+            return *this;
+        }
+
+        /**
+         * Rasterize the image view.  Simply invokes the default
+         * rasterization function.
+         */
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            ops::rasterize( prerasterize( bbox ), dest, bbox );
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Image_Scratch";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + math::Compound_Name<pixel_type>::name() + ">";
+        }
+
+    private:
+
+        /// Directory holding the scratch file
+        std::filesystem::path m_directory { std::filesystem::temp_directory_path() };
+
+        /// Mapped scratch file
+        std::shared_ptr<uint8_t> m_mapping;
+
+        /// Image Traits
+        size_t m_rows { 0 };
+        size_t m_cols { 0 };
+        size_t m_planes { 0 };
+
+        /// Pixel Origin
+        PixelT* m_origin { nullptr };
+
+        size_t m_rstride { 0 };
+        size_t m_pstride { 0 };
+
+}; // End of Image_Scratch Class
+
+/// Specifies that Image_Scratch objects are resizable.
+template <class PixelT>
+struct Is_Resizable<Image_Scratch<PixelT>>
+{
+    typedef std::true_type value;
+};
+
+/// Specifies that Image_Scratch objects are fast to access.
+template <class PixelT>
+struct Is_Multiply_Accessible<Image_Scratch<PixelT>>
+{
+    typedef std::true_type value;
+};
+
+/// Specifies that Image_Scratch objects can be handed to resources as a buffer.
+template <class PixelT>
+struct Is_Memory_Buffered<Image_Scratch<PixelT>>
+{
+    typedef std::true_type value;
+};
+
+} // End of tmns::image namespace
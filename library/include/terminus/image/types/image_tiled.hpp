@@ -0,0 +1,444 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_tiled.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/error.hpp>
+#include <terminus/math/Point.hpp>
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
+
+// Terminus Image Libraries
+#include <terminus/image/pixel/pixel_accessor_tiled.hpp>
+#include <terminus/image/types/image_base.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_traits.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace tmns::image {
+
+/**
+ * In-memory image stored as square tiles.
+ *
+ * Each TileSize x TileSize tile is contiguous, so 2-D neighborhoods touch a few
+ * cache lines and pages instead of one per row.  Tiles start on cache-line
+ * boundaries, so threads writing separate tiles never share a line.  Edge tiles
+ * are padded to full size.
+ *
+ * Use tile_bbox() and tile_data() to hand tiles to workers directly.
+*/
+template <typename PixelT, size_t TileSize = 64>
+class Image_Tiled : public Image_Base<Image_Tiled<PixelT,TileSize>>
+{
+    public:
+
+        static_assert( std::is_trivially_destructible_v<PixelT>,
+                       "Image_Tiled pixels must be trivially destructible" );
+
+        /// Pixel Type
+        typedef PixelT pixel_type;
+
+        /// Return type when you query actual data
+        typedef PixelT& result_type;
+
+        /// Base type of the image
+        typedef Image_Base<Image_Tiled<PixelT,TileSize>> base_type;
+
+        /// Prerasterize Type
+        typedef Image_Tiled prerasterize_type;
+
+        /// Accessor Type
+        typedef Pixel_Accessor_Tiled<PixelT,TileSize> pixel_accessor;
+
+        /// Tile width and height, in pixels
+        static constexpr size_t TILE_SIZE = TileSize;
+
+        /// Number of pixels in a tile
+        static constexpr size_t TILE_PIXELS = TileSize * TileSize;
+
+        /**
+         * Default Constructor
+        */
+        Image_Tiled() = default;
+
+        /**
+         * Build an image of the given size.  Pixels are zeroed.
+        */
+        Image_Tiled( size_t cols, size_t rows, size_t planes = 1 )
+        {
+            auto result = set_size( cols, rows, planes );
+            if( result.has_error() )
+            {
+                throw std::runtime_error( result.error().message() );
+            }
+        }
+
+        /**
+         * Build the image from any other image type, one tile at a time
+        */
+        template <typename ImageT>
+        Image_Tiled( const Image_Base<ImageT>& image )
+          : Image_Tiled( image.impl().cols(),
+                         image.impl().rows(),
+                         image.impl().planes() )
+        {
+            rasterize_from( image.impl() );
+        }
+
+        /**
+         * Rasterize another image into this one, resizing as needed
+        */
+        template <typename InputImageT>
+        const Image_Tiled& operator = ( const Image_Base<InputImageT>& input_image )
+        {
+            auto result = set_size( input_image.impl().cols(),
+                                    input_image.impl().rows(),
+                                    input_image.impl().planes() );
+            if( result.has_error() )
+            {
+                throw std::runtime_error( result.error().message() );
+            }
+            rasterize_from( input_image.impl() );
+
+            // Transfer other components
+            this->copy_payload_data( input_image.impl() );
+
+            return *this;
+        }
+
+        /**
+         * Get the number of rows in the image
+        */
+        size_t rows() const { return m_rows; }
+
+        /**
+         * Get the number of columns in the image
+         */
+        size_t cols() const { return m_cols; }
+
+        /**
+         * Get the number of planes in the image
+         */
+        size_t planes() const { return m_planes; }
+
+        /**
+         * Get the number of tiles across the image
+        */
+        size_t tiles_per_row() const { return m_tiles_per_row; }
+
+        /**
+         * Get the number of tiles down the image
+        */
+        size_t tiles_per_col() const { return m_tiles_per_col; }
+
+        /**
+         * Get the tile size as a block size for block processing
+        */
+        math::Size2i block_size() const
+        {
+            return math::Size2i( { (int)TileSize, (int)TileSize } );
+        }
+
+        /**
+         * Get the image origin
+        */
+        pixel_accessor origin() const
+        {
+            return pixel_accessor( m_data.get(),
+                                   m_tiles_per_row,
+                                   m_pstride );
+        }
+
+        /**
+         * Return specific pixel position
+         */
+        result_type operator()( size_t col,
+                                size_t row,
+                                size_t plane = 0 ) const
+        {
+            return m_data[ plane * m_pstride
+                         + ( ( row / TileSize ) * m_tiles_per_row + ( col / TileSize ) ) * TILE_PIXELS
+                         + ( row % TileSize ) * TileSize
+                         + ( col % TileSize ) ];
+        }
+
+        /**
+         * Return specific pixel position
+         */
+        result_type operator()( const tmns::math::Point2i& loc,
+                                size_t                     plane = 0 ) const
+        {
+            return this->operator()( loc.x(), loc.y(), plane );
+        }
+
+        /**
+         * Get the region of the image covered by a tile, clipped to the image
+        */
+        math::Rect2i tile_bbox( size_t tile_x, size_t tile_y ) const
+        {
+            return math::Rect2i::intersection( math::Rect2i( tile_x * TileSize,
+                                                             tile_y * TileSize,
+                                                             TileSize,
+                                                             TileSize ),
+                                               this->full_bbox() );
+        }
+
+        /**
+         * Get the pixels of a tile.  Rows are TileSize pixels apart, including
+         * the padding on edge tiles.
+        */
+        pixel_type* tile_data( size_t tile_x,
+                               size_t tile_y,
+                               size_t plane = 0 ) const
+        {
+            return m_data.get() + plane * m_pstride + ( tile_y * m_tiles_per_row + tile_x ) * TILE_PIXELS;
+        }
+
+        /**
+         * Resize the image, allocating new memory if the size has changed.
+        */
+        Result<void> set_size( size_t cols,
+                               size_t rows,
+                               size_t planes = 1 )
+        {
+            if( cols == m_cols && rows == m_rows && planes == m_planes )
+            {
+                return outcome::ok();
+            }
+
+            const size_t tiles_per_row = ( cols + TileSize - 1 ) / TileSize;
+            const size_t tiles_per_col = ( rows + TileSize - 1 ) / TileSize;
+            const size_t num_pixels    = tiles_per_row * tiles_per_col * TILE_PIXELS * planes;
+
+            if( num_pixels == 0 )
+            {
+                m_data.reset();
+            }
+            else
+            {
+                // Start every tile on a cache line
+                constexpr size_t alignment = std::max<size_t>( 64, alignof( PixelT ) );
+                const size_t num_bytes = ( num_pixels * sizeof( PixelT ) + alignment - 1 ) / alignment * alignment;
+
+                PixelT* data = static_cast<PixelT*>( std::aligned_alloc( alignment, num_bytes ) );
+                if( !data )
+                {
+                    std::stringstream sout;
+                    sout << "Cannot allocate enough memory for a " << cols << " x "
+                         << rows << " x " << planes << " tiled image.";
+                    return outcome::fail( error::Error_Code::OUT_OF_MEMORY,
+                                          sout.str() );
+                }
+                std::uninitialized_value_construct_n( data, num_pixels );
+                m_data = std::shared_ptr<PixelT[]>( data, []( PixelT* ptr ){ std::free( ptr ); } );
+            }
+
+            m_cols          = cols;
+            m_rows          = rows;
+            m_planes        = planes;
+            m_tiles_per_row = tiles_per_row;
+            m_tiles_per_col = tiles_per_col;
+            m_pstride       = tiles_per_row * tiles_per_col * TILE_PIXELS;
+
+            return outcome::ok();
+        }
+
+        /**
+         * Release the pixels
+        */
+        void reset()
+        {
+            m_data.reset();
+            m_cols          = 0;
+            m_rows          = 0;
+            m_planes        = 0;
+            m_tiles_per_row = 0;
+            m_tiles_per_col = 0;
+            m_pstride       = 0;
+        }
+
+        /**
+         * Check if valid image
+        */
+        bool is_valid_image() const
+        {
+            return !(!m_data);
+        }
+
+        /**
+         * Prepare an Image_Tiled instance to be rasterized.  Returns the
+         * original view, since memory means it's already prepped.
+        */
+        prerasterize_type prerasterize([[maybe_unused]] const math::Rect2i& bbox ) const
+        {
+            return *this;
+        }
+
+        /**
+         * Rasterize the image, walking the tiles which overlap the region so each is
+         * read in a single contiguous pass.
+         */
+        template <class DestT>
+        void rasterize( const DestT&        dest,
+                        const math::Rect2i& bbox ) const
+        {
+            typedef typename DestT::pixel_type DestPixelT;
+
+            if( ((int)dest.cols()) != bbox.width() ||
+                ((int)dest.rows()) != bbox.height() ||
+                dest.planes()      != planes() )
+            {
+                std::stringstream sout;
+                sout << "Image_Tiled::rasterize: Source and destination must have same dimensions. Region: "
+                     << bbox.to_string() << ", Dest: " << dest.cols() << " x " << dest.rows();
+                throw std::runtime_error( sout.str() );
+            }
+
+            for_each_tile_row( bbox, [&]( const PixelT* src, int x, int y, int width, size_t p ) {
+                const int dx = x - bbox.min().x();
+                const int dy = y - bbox.min().y();
+                if constexpr( Is_Memory_Buffered<DestT>::value::value &&
+                              std::is_same_v<DestPixelT,PixelT> )
+                {
+                    std::copy( src, src + width, &dest( dx, dy, p ) );
+                }
+                else
+                {
+                    for( int i = 0; i < width; ++i )
+                    {
+                        dest( dx + i, dy, p ) = DestPixelT( src[i] );
+                    }
+                }
+            });
+        }
+
+        /**
+         * Get this class name
+        */
+        static std::string class_name()
+        {
+            return "Image_Tiled";
+        }
+
+        static std::string full_name()
+        {
+            return class_name() + "<" + math::Compound_Name<pixel_type>::name() + ">";
+        }
+
+    private:
+
+        /**
+         * Call a function for each row segment of each tile overlapping a region,
+         * tile by tile.  The function gets the segment pixels, its image position,
+         * its width and the plane.
+        */
+        template <typename FuncT>
+        void for_each_tile_row( const math::Rect2i& bbox,
+                                FuncT&&             func ) const
+        {
+            auto region = math::Rect2i::intersection( bbox, this->full_bbox() );
+            if( region.width() <= 0 || region.height() <= 0 )
+            {
+                return;
+            }
+
+            const size_t tx0 = region.min().x() / TileSize;
+            const size_t tx1 = ( region.max().x() - 1 ) / TileSize;
+            const size_t ty0 = region.min().y() / TileSize;
+            const size_t ty1 = ( region.max().y() - 1 ) / TileSize;
+
+            for( size_t p  = 0;   p  < m_planes; ++p  ) {
+            for( size_t ty = ty0; ty <= ty1;     ++ty ) {
+            for( size_t tx = tx0; tx <= tx1;     ++tx )
+            {
+                auto tile = math::Rect2i::intersection( tile_bbox( tx, ty ), region );
+                const PixelT* data = tile_data( tx, ty, p );
+                for( int y = tile.min().y(); y < tile.max().y(); ++y )
+                {
+                    func( data + ( y % TileSize ) * TileSize + ( tile.min().x() % TileSize ),
+                          tile.min().x(),
+                          y,
+                          tile.width(),
+                          p );
+                }
+            }}}
+        }
+
+        /**
+         * Fill the image from another image, one tile at a time
+        */
+        template <typename ImageT>
+        void rasterize_from( const ImageT& image )
+        {
+            Image_Memory<PixelT> buffer;
+            for( size_t ty = 0; ty < m_tiles_per_col; ++ty ) {
+            for( size_t tx = 0; tx < m_tiles_per_row; ++tx )
+            {
+                auto bbox = tile_bbox( tx, ty );
+                buffer.set_size( bbox.width(), bbox.height(), m_planes );
+                image.rasterize( buffer, bbox );
+
+                for( size_t p = 0; p < m_planes; ++p )
+                {
+                    PixelT* data = tile_data( tx, ty, p );
+                    for( int y = 0; y < bbox.height(); ++y )
+                    {
+                        std::copy( &buffer( 0, y, p ),
+                                   &buffer( 0, y, p ) + bbox.width(),
+                                   data + y * TileSize );
+                    }
+                }
+            }}
+        }
+
+        /// Pixel Data
+        std::shared_ptr<PixelT[]> m_data;
+
+        /// Image Traits
+        size_t m_rows { 0 };
+        size_t m_cols { 0 };
+        size_t m_planes { 0 };
+
+        /// Tile Grid
+        size_t m_tiles_per_row { 0 };
+        size_t m_tiles_per_col { 0 };
+
+        /// Pixels per plane, including padding
+        size_t m_pstride { 0 };
+
+}; // End of Image_Tiled Class
+
+/// Specifies that Image_Tiled objects are resizable.
+template <class PixelT, size_t TileSize>
+struct Is_Resizable<Image_Tiled<PixelT,TileSize>>
+{
+    typedef std::true_type value;
+};
+
+/// Specifies that Image_Tiled objects are fast to access.
+template <class PixelT, size_t TileSize>
+struct Is_Multiply_Accessible<Image_Tiled<PixelT,TileSize>>
+{
+    typedef std::true_type value;
+};
+
+} // End of tmns::image namespace
@@ -16,8 +16,13 @@
 
 // Terminus Libraries
 #include <terminus/image/types/image_base.hpp>
+#include <terminus/math/Rectangle.hpp>
+#include <terminus/math/Size.hpp>
 
 // C++ Libraries
+#include <concepts>
+#include <cstddef>
+#include <span>
 #include <type_traits>
 
 namespace tmns::image {
@@ -51,4 +56,57 @@ struct Is_Multiply_Accessible
     typedef std::false_type value;
 };
 
+/// Indicates whether a view's pixels already live in memory and can be described,
+/// without copying, by the Image_Buffer returned from <B>buffer()</B>.
+template <class ImplT>
+struct Is_Memory_Buffered
+{
+    typedef std::false_type value;
+};
+
+/// Indicates whether a view can report regions holding no data via <B>is_empty()</B>.
+/// Empty regions read back as <B>fill_pixel()</B> and are aligned to <B>block_size()</B>,
+/// so they can be produced without touching the source.  <B>has_empty_regions()</B>
+/// tells at run time whether the source can report any.
+template <class ImplT>
+struct Has_Empty_Regions
+{
+    typedef std::bool_constant<requires( const ImplT& image, const math::Rect2i& bbox ) {
+                                   { image.has_empty_regions() } -> std::convertible_to<bool>;
+                                   { image.is_empty( bbox ) } -> std::convertible_to<bool>;
+                                   { image.fill_pixel() } -> std::convertible_to<typename ImplT::pixel_type>;
+                                   { image.block_size() } -> std::convertible_to<math::Size2i>;
+                               }> value;
+};
+
+/// Indicates whether a pixel accessor can hand out the next <B>n</B> pixels of its row,
+/// starting at its position, as a contiguous span via <B>row_span( n )</B>.
+template <class AccessorT>
+struct Has_Row_Span
+{
+    typedef std::bool_constant<requires( const AccessorT& acc, size_t n ) {
+                                   { acc.row_span( n ) } -> std::convertible_to<std::span<const typename AccessorT::pixel_type>>;
+                               }> value;
+};
+
+/// Indicates whether a pixel accessor can fill a caller buffer with the next <B>n</B>
+/// pixels of its row, starting at its position, via <B>read_row( output, n )</B>.
+template <class AccessorT>
+struct Has_Row_Read
+{
+    typedef std::bool_constant<requires( const AccessorT& acc, typename AccessorT::pixel_type* output, size_t n ) {
+                                   acc.read_row( output, n );
+                               }> value;
+};
+
+/// Indicates whether a per-pixel functor can transform a whole batch of pixels in one call
+/// via <B>operator()( std::span<const InputT>, std::span<OutputT> )</B>.
+template <class FunctorT, class InputT, class OutputT>
+struct Has_Batched_Call
+{
+    typedef std::bool_constant<requires( const FunctorT& func, std::span<const InputT> input, std::span<OutputT> output ) {
+                                   func( input, output );
+                               }> value;
+};
+
 } // End of tmns::image namespace
\ No newline at end of file
@@ -17,6 +17,13 @@
 // Terminus Libraries
 #include <terminus/log/utility.hpp>
 
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// C++ Libraries
+#include <fstream>
+#include <typeinfo>
+
 namespace tmns::image::io {
 
 /************************************************************************************/
@@ -24,19 +31,48 @@ namespace tmns::image::io {
 /************************************************************************************/
 Result<Image_Resource_Disk::ptr_t> Disk_Driver_Manager::pick_read_driver( const std::filesystem::path& pathname ) const
 {
+    // Factories are identified by type, so fresh managers share cached handles and probes
+    std::vector<std::string> driver_keys;
     for( const auto& factory : m_read_driver_factories )
     {
-        if( factory->is_read_image_supported( pathname ) )
+        driver_keys.push_back( typeid( *factory ).name() );
+    }
+
+    if( m_handle_cache )
+    {
+        if( auto cached = m_handle_cache->find( pathname, driver_keys ) )
         {
-            auto new_driver = factory->create_read_driver( pathname );
-            if( new_driver.has_error() )
+            return outcome::ok<Image_Resource_Disk::ptr_t>( std::move( cached ) );
+        }
+    }
+
+    // Files which look like one we have already opened skip probing
+    const auto signature = probe_signature( pathname );
+    const auto known_driver = probe_cache_find( signature );
+    for( size_t i = 0; i < m_read_driver_factories.size() && !known_driver.empty(); ++i )
+    {
+        if( driver_keys[i] == known_driver )
+        {
+            auto result = open_read_driver( i, pathname, driver_keys[i] );
+            if( result.has_value() )
             {
-                return outcome::fail( error::Error_Code::DRIVER_NOT_FOUND,
-                                      "Failed to find new write driver: ",
-                                      "MSG: ", new_driver.error().message() );
+                return result;
             }
-            auto driver_ptr = std::dynamic_pointer_cast<Image_Resource_Disk>( new_driver.assume_value() );
-            return outcome::ok<Image_Resource_Disk::ptr_t>( std::move( driver_ptr ) );
+            probe_cache_erase( signature );
+            break;
+        }
+    }
+
+    for( size_t i = 0; i < m_read_driver_factories.size(); ++i )
+    {
+        if( m_read_driver_factories[i]->is_read_image_supported( pathname ) )
+        {
+            auto result = open_read_driver( i, pathname, driver_keys[i] );
+            if( result.has_value() )
+            {
+                probe_cache_insert( signature, driver_keys[i] );
+            }
+            return result;
         }
     }
     return outcome::fail( error::Error_Code::DRIVER_NOT_FOUND,
@@ -52,6 +88,13 @@ Result<Image_Resource_Disk::ptr_t> Disk_Driver_Manager::pick_write_driver( const
                                                                            const math::Size2i&                      block_size ) const
 {
     tmns::log::trace( ADD_CURRENT_LOC(), "Start of Method" );
+
+    // Release any read handle on the file being replaced
+    if( m_handle_cache )
+    {
+        m_handle_cache->erase( pathname );
+    }
+
     for( const auto& factory : m_write_driver_factories )
     {
         if( factory->is_write_image_supported( pathname ) )
@@ -73,6 +116,104 @@ Result<Image_Resource_Disk::ptr_t> Disk_Driver_Manager::pick_write_driver( const
     return outcome::fail( error::Error_Code::DRIVER_NOT_FOUND );
 }
 
+/************************************************/
+/*          Set the open-resource cache         */
+/************************************************/
+void Disk_Driver_Manager::set_handle_cache( Resource_Handle_Cache::ptr_t cache )
+{
+    m_handle_cache = std::move( cache );
+}
+
+/****************************************************/
+/*          Open a file with a specific factory     */
+/****************************************************/
+Result<Image_Resource_Disk::ptr_t> Disk_Driver_Manager::open_read_driver( size_t                       index,
+                                                                          const std::filesystem::path& pathname,
+                                                                          const std::string&           driver_key ) const
+{
+    auto new_driver = m_read_driver_factories[index]->create_read_driver( pathname );
+    if( new_driver.has_error() )
+    {
+        return outcome::fail( error::Error_Code::DRIVER_NOT_FOUND,
+                              "Failed to find new read driver: ",
+                              "MSG: ", new_driver.error().message() );
+    }
+    auto driver_ptr = std::dynamic_pointer_cast<Image_Resource_Disk>( new_driver.assume_value() );
+    if( m_handle_cache )
+    {
+        driver_ptr = m_handle_cache->insert( pathname, driver_key, std::move( driver_ptr ) );
+    }
+    return outcome::ok<Image_Resource_Disk::ptr_t>( std::move( driver_ptr ) );
+}
+
+/****************************************************/
+/*          Get the probe signature for a file      */
+/****************************************************/
+std::string Disk_Driver_Manager::probe_signature( const std::filesystem::path& pathname )
+{
+    std::string signature = boost::to_lower_copy( pathname.extension().string() );
+    signature.push_back( '|' );
+
+    char magic[PROBE_MAGIC_BYTES] {};
+    std::ifstream fin( pathname, std::ios::binary );
+    fin.read( magic, sizeof( magic ) );
+    signature.append( magic, fin.gcount() );
+    return signature;
+}
+
+/****************************************************/
+/*          Look up a driver from the probe cache   */
+/****************************************************/
+std::string Disk_Driver_Manager::probe_cache_find( const std::string& signature )
+{
+    std::unique_lock<std::mutex> lock( probe_cache_mutex() );
+    auto it = probe_cache().find( signature );
+    return ( it == probe_cache().end() ) ? std::string() : it->second;
+}
+
+/****************************************************/
+/*          Record the driver for a signature       */
+/****************************************************/
+void Disk_Driver_Manager::probe_cache_insert( const std::string& signature,
+                                              const std::string& driver_key )
+{
+    std::unique_lock<std::mutex> lock( probe_cache_mutex() );
+
+    // Raw formats have no magic, so their signatures never repeat.  Keep the cache bounded.
+    if( probe_cache().size() >= MAX_PROBE_CACHE_ENTRIES )
+    {
+        probe_cache().clear();
+    }
+    probe_cache()[signature] = driver_key;
+}
+
+/****************************************************/
+/*          Forget the driver for a signature       */
+/****************************************************/
+void Disk_Driver_Manager::probe_cache_erase( const std::string& signature )
+{
+    std::unique_lock<std::mutex> lock( probe_cache_mutex() );
+    probe_cache().erase( signature );
+}
+
+/********************************************/
+/*          Get the shared probe cache      */
+/********************************************/
+std::unordered_map<std::string,std::string>& Disk_Driver_Manager::probe_cache()
+{
+    static std::unordered_map<std::string,std::string> cache;
+    return cache;
+}
+
+/************************************************/
+/*          Get the probe cache lock            */
+/************************************************/
+std::mutex& Disk_Driver_Manager::probe_cache_mutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
 /************************************************/
 /*      Add new factory to driver manager       */
 /************************************************/
@@ -24,7 +24,11 @@
 #include <terminus/error.hpp>
 
 /// C++ Libraries
+#include <algorithm>
+#include <cstring>
+#include <list>
 #include <mutex>
+#include <vector>
 
 // GDAL Libraries
 #include <gdal.h>
@@ -69,8 +73,34 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
     auto logger = get_master_gdal_logger();
     logger.trace( "Opening dataset for file: ", pathname.native() );
 
-    /// Create the GDAL Dataset
-    m_read_dataset.reset( (GDALDataset*)GDALOpen( pathname.native().c_str(), GA_ReadOnly ), GDAL_Deleter_Null_Okay );
+    /// Create the GDAL Dataset.  Restrict GDAL to the drivers expected for the extension
+    /// so it skips probing every registered driver, falling back to a full scan.
+    std::list<std::string> allowed_names = gdal_file_format_from_filename::format( pathname );
+    if( !allowed_names.empty() )
+    {
+        std::vector<const char*> allowed_drivers;
+        for( const auto& name : allowed_names )
+        {
+            allowed_drivers.push_back( name.c_str() );
+        }
+        allowed_drivers.push_back( nullptr );
+
+        m_read_dataset.reset( (GDALDataset*)GDALOpenEx( pathname.native().c_str(),
+                                                        GDAL_OF_RASTER | GDAL_OF_READONLY,
+                                                        allowed_drivers.data(),
+                                                        nullptr,
+                                                        nullptr ),
+                              GDAL_Deleter_Null_Okay );
+    }
+    if( !m_read_dataset )
+    {
+        m_read_dataset.reset( (GDALDataset*)GDALOpenEx( pathname.native().c_str(),
+                                                        GDAL_OF_RASTER | GDAL_OF_READONLY,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr ),
+                              GDAL_Deleter_Null_Okay );
+    }
 
     // Make sure it opens okay
     if( !m_read_dataset )
@@ -92,11 +122,7 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
     m_format.set_cols( static_cast<size_t>(dataset->GetRasterXSize()) );
     m_format.set_rows( static_cast<size_t>(dataset->GetRasterYSize()) );
 
-    // Log the metadata information
-    {
-        process_metadata( logger,
-                          dataset );
-    }
+    // Dataset metadata is loaded on the first call to metadata()
 
     /**
      * Figure out which pixel format to use from the band composition.  This is oddly difficult,
@@ -182,19 +208,23 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
         // Fetch the color table and add to table
         GDALColorTable* color_table = dataset->GetRasterBand(1)->GetColorTable();
 
-        m_color_table.resize( static_cast<size_t>(color_table->GetColorEntryCount()) );
+        std::vector<PixelRGBA_u8> colors( static_cast<size_t>(color_table->GetColorEntryCount()) );
         GDALColorEntry color;
-        for( size_t i=0; i<m_color_table.size(); i++ )
+        for( size_t i=0; i<colors.size(); i++ )
         {
             color_table->GetColorEntryAsRGB( static_cast<int>(i), &color );
-            m_color_table[i] = PixelRGBA_u8( static_cast<uint8_t>(color.c1),
-                                           static_cast<uint8_t>(color.c2),
-                                           static_cast<uint8_t>(color.c3),
-                                           static_cast<uint8_t>(color.c4) );
+            colors[i] = PixelRGBA_u8( static_cast<uint8_t>(color.c1),
+                                      static_cast<uint8_t>(color.c2),
+                                      static_cast<uint8_t>(color.c3),
+                                      static_cast<uint8_t>(color.c4) );
         }
+        m_palette = std::make_shared<const Palette>( colors );
     }
 
     // Get the block size
+    int native_cols, native_rows;
+    dataset->GetRasterBand(1)->GetBlockSize( &native_cols, &native_rows );
+    m_native_blocksize = math::Size2i( { native_cols, native_rows } );
     m_blocksize = default_block_size();
 
     return outcome::ok();
@@ -206,6 +236,122 @@ Result<void> GDAL_Disk_Image_Impl::open( const std::filesystem::path& pathname )
 Result<void> GDAL_Disk_Image_Impl::read( const Image_Buffer&  dest,
                                          const math::Rect2i&  bbox,
                                          bool                 rescale ) const
+{
+    // Whole native blocks are decoded straight from the file.  Callers reading by
+    // block keep their own cache, so GDAL's block cache would only hold a second copy.
+    if( auto block_index = native_block_index( bbox ) )
+    {
+        return read_block( block_index->x(),
+                           block_index->y(),
+                           dest,
+                           rescale );
+    }
+    return read_raster( dest, bbox, rescale );
+}
+
+/****************************************************/
+/*          Read a single native block              */
+/****************************************************/
+Result<void> GDAL_Disk_Image_Impl::read_block( int                 ix,
+                                               int                 iy,
+                                               const Image_Buffer& dest,
+                                               bool                rescale ) const
+{
+    const int block_cols = m_blocksize.width();
+    const int block_rows = m_blocksize.height();
+    auto bbox = math::Rect2i::intersection( math::Rect2i( ix * block_cols,
+                                                          iy * block_rows,
+                                                          block_cols,
+                                                          block_rows ),
+                                            format().bbox() );
+    if( ix < 0 || iy < 0 || bbox.width() <= 0 || bbox.height() <= 0 )
+    {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Block (", ix, ", ", iy, ") is outside the image. ",
+                              format().bbox().to_string() );
+    }
+
+    // Palettes are expanded by RasterIO, and a block size which differs from the
+    // file's no longer lines up with ReadBlock().  Dirty blocks also live in the cache.
+    if( m_palette                                          ||
+        m_write_dataset                                    ||
+        block_cols != m_native_blocksize.width()           ||
+        block_rows != m_native_blocksize.height() )
+    {
+        return read_raster( dest, bbox, rescale );
+    }
+
+    Image_Format src_fmt = format();
+    src_fmt.set_cols( static_cast<size_t>(bbox.width()) );
+    src_fmt.set_rows( static_cast<size_t>(bbox.height()) );
+
+    const size_t ch_size   = channel_size_bytes( src_fmt.channel_type() ).value();
+    const size_t nchannels = static_cast<size_t>( num_channels( src_fmt.pixel_type() ).value() );
+    const size_t nbands    = nchannels * src_fmt.planes();
+    const size_t band_size = static_cast<size_t>(block_cols) * static_cast<size_t>(block_rows) * ch_size;
+
+    // ReadBlock() always fills a whole block, one band at a time
+    std::vector<uint8_t> block_data( band_size * nbands );
+    {
+        std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+
+        auto dataset = get_dataset_ptr().value();
+        for( size_t b = 0; b < nbands; ++b )
+        {
+            auto* band = dataset->GetRasterBand( static_cast<int>( b + 1 ) );
+            uint8_t* band_data = block_data.data() + b * band_size;
+
+            // Pixel-interleaved files decode every band of a block at once, leaving the
+            // other bands in GDAL's cache.  Take them from there and evict them.
+            if( GDALRasterBlock* cached = band->TryGetLockedBlockRef( ix, iy ) )
+            {
+                std::memcpy( band_data, cached->GetDataRef(), band_size );
+                cached->DropLock();
+                band->FlushBlock( ix, iy );
+            }
+            else if( band->ReadBlock( ix, iy, band_data ) != CE_None )
+            {
+                return outcome::fail( error::Error_Code::GDAL_FAILURE,
+                                      "ReadBlock failed for block (", ix, ", ", iy, ") of band ",
+                                      b + 1, ": ", CPLGetLastErrorMsg() );
+            }
+        }
+    }
+
+    // Single-channel bands are already laid out as planes
+    if( nchannels == 1 )
+    {
+        return convert_read( dest,
+                             Image_Buffer( block_data.data(),
+                                           src_fmt,
+                                           ch_size,
+                                           static_cast<size_t>(block_cols) * ch_size,
+                                           band_size ),
+                             rescale );
+    }
+
+    // Otherwise interleave the channels
+    std::vector<uint8_t> pixel_data( src_fmt.raster_size_bytes() );
+    Image_Buffer src( src_fmt, pixel_data.data() );
+    for( size_t p = 0; p < src_fmt.planes(); ++p ) {
+    for( size_t c = 0; c < nchannels;        ++c ) {
+        const uint8_t* band_data = block_data.data() + ( c + p ) * band_size;
+        for( int y = 0; y < bbox.height(); ++y ) {
+        for( int x = 0; x < bbox.width();  ++x ) {
+            std::memcpy( (uint8_t*) src( x, y, static_cast<int>(p) ) + ch_size * c,
+                         band_data + ( static_cast<size_t>(y) * block_cols + x ) * ch_size,
+                         ch_size );
+        }}
+    }}
+    return convert_read( dest, src, rescale );
+}
+
+/****************************************************/
+/*          Read a region through RasterIO          */
+/****************************************************/
+Result<void> GDAL_Disk_Image_Impl::read_raster( const Image_Buffer&  dest,
+                                                const math::Rect2i&  bbox,
+                                                bool                 rescale ) const
 {
     // Perform bounds checks
     if( !format().bbox().is_inside( bbox ) )
@@ -237,7 +383,7 @@ Result<void> GDAL_Disk_Image_Impl::read( const Image_Buffer&  dest,
             return outcome::fail( error::Error_Code::INVALID_INPUT,
                                   "Channel size too large for GDAL API" );
         }
-        if( m_color_table.empty() )
+        if( !m_palette )
         {
             auto nchannels = num_channels( format().pixel_type() ).value();
             for( size_t p = 0; p < format().planes();   ++p ) {
@@ -269,30 +415,124 @@ Result<void> GDAL_Disk_Image_Impl::read( const Image_Buffer&  dest,
         // Convert the color table
         else
         {
-            GDALRasterBand* band = dataset->GetRasterBand(1);
-            uint8_t* index_data = new uint8_t[ static_cast<size_t>(bbox.width()) * static_cast<size_t>(bbox.height()) ];
-            CPLErr result = band->RasterIO( GF_Read, bbox.min().x(), bbox.min().y(), bbox.width(), bbox.height(),
-                                           index_data, bbox.width(), bbox.height(), GDT_Byte, 1, bbox.width() );
+            std::vector<uint8_t> index_data( static_cast<size_t>(bbox.width()) * static_cast<size_t>(bbox.height()) );
+            CPLErr result = read_indices_locked( dataset, bbox, index_data.data(), 1, bbox.width() );
             if (result != CE_None)
             {
                 logger.warn( "RasterIO problem: ",
                                  CPLGetLastErrorMsg() );
             }
 
+            m_palette->expand( index_data.data(),
+                               1,
+                               index_data.size(),
+                               (uint8_t*) src.data(),
+                               sizeof( PixelRGBA_u8 ) );
+        }
+    }
 
-            PixelRGBA_u8* rgba_data = (PixelRGBA_u8*) src.data();
-            for( int i=0; i<bbox.width()*bbox.height(); ++i )
-            {
-                rgba_data[i] = m_color_table[index_data[i]];
-            }
+    return convert_read( dest, src, rescale );
+}
 
-            delete [] index_data;
+/****************************************************************/
+/*          Convert raw file data into the read destination      */
+/****************************************************************/
+Result<void> GDAL_Disk_Image_Impl::convert_read( const Image_Buffer& dest,
+                                                 const Image_Buffer& src,
+                                                 bool                rescale ) const
+{
+    // Masked destinations get their validity channel from the nodata value while
+    // converting, rather than through a second pass over a full-size copy.
+    if( is_masked( dest.format().pixel_type() ) )
+    {
+        std::optional<double> nodata;
+        if( auto value = nodata_read_ok(); !value.has_error() )
+        {
+            nodata = value.value();
         }
+        return convert_masked( dest, src, nodata, rescale );
     }
-
     return convert( dest, src, rescale );
 }
 
+/************************************************/
+/*          Read raw palette indices            */
+/************************************************/
+Result<void> GDAL_Disk_Image_Impl::read_indices( const Image_Buffer&  dest,
+                                                 const math::Rect2i&  bbox ) const
+{
+    if( !m_palette )
+    {
+        return outcome::fail( error::Error_Code::INVALID_PIXEL_TYPE,
+                              "Image has no color palette: ", m_pathname.native() );
+    }
+    if( !format().bbox().is_inside( bbox ) )
+    {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Bounding box outside the bounds of the image. ",
+                              format().bbox().to_string(),
+                              ", Requested: " + bbox.to_string() );
+    }
+
+    Image_Format index_fmt = format();
+    index_fmt.set_cols( static_cast<size_t>(bbox.width()) );
+    index_fmt.set_rows( static_cast<size_t>(bbox.height()) );
+    index_fmt.set_pixel_type( Pixel_Format_Enum::GRAY );
+    index_fmt.set_channel_type( Channel_Type_Enum::UINT8 );
+    index_fmt.set_planes( 1 );
+
+    // Single-plane 8-bit destinations are filled in place
+    const bool in_place = dest.format().pixel_type()   == Pixel_Format_Enum::GRAY &&
+                          dest.format().channel_type() == Channel_Type_Enum::UINT8 &&
+                          dest.format().planes()       == 1;
+
+    std::vector<uint8_t> index_data;
+    Image_Buffer src = dest;
+    if( !in_place )
+    {
+        index_data.resize( index_fmt.raster_size_bytes() );
+        src = Image_Buffer( index_fmt, index_data.data() );
+    }
+
+    {
+        std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+        auto dataset = get_dataset_ptr().value();
+        if( read_indices_locked( dataset, bbox, (uint8_t*) src.data(), src.cstride(), src.rstride() ) != CE_None )
+        {
+            return outcome::fail( error::Error_Code::GDAL_FAILURE,
+                                  "RasterIO problem: ", CPLGetLastErrorMsg() );
+        }
+    }
+
+    if( in_place )
+    {
+        return outcome::ok();
+    }
+    return convert( dest, src, false );
+}
+
+/****************************************************/
+/*          Read palette indices from band 1        */
+/****************************************************/
+CPLErr GDAL_Disk_Image_Impl::read_indices_locked( std::shared_ptr<GDALDataset> dataset,
+                                                  const math::Rect2i&          bbox,
+                                                  uint8_t*                     data,
+                                                  size_t                       cstride,
+                                                  size_t                       rstride ) const
+{
+    return dataset->GetRasterBand(1)->RasterIO( GF_Read,
+                                                bbox.min().x(),
+                                                bbox.min().y(),
+                                                bbox.width(),
+                                                bbox.height(),
+                                                data,
+                                                bbox.width(),
+                                                bbox.height(),
+                                                GDT_Byte,
+                                                static_cast<GSpacing>(cstride),
+                                                static_cast<GSpacing>(rstride) );
+}
+
 /****************************************************/
 /*          Write the image buffer to disk          */
 /****************************************************/
@@ -380,10 +620,18 @@ std::string GDAL_Disk_Image_Impl::To_Log_String( size_t offset ) const
     sout << gap << "   - write dataset set: " << std::boolalpha << (m_write_dataset != 0) << std::endl;
     sout << m_format.to_string( offset + 2 );
     sout << gap << "   - Block Size: " << m_blocksize.to_string() << std::endl;
-    sout << gap << "   - Color Table Size: " << m_color_table.size() << std::endl;
+    sout << gap << "   - Color Table Size: " << ( m_palette ? m_palette->size() : 0 ) << std::endl;
     return sout.str();
 }
 
+/****************************************/
+/*          Get the color palette       */
+/****************************************/
+Palette::ptr_t GDAL_Disk_Image_Impl::palette() const
+{
+    return m_palette;
+}
+
 /********************************************/
 /*          Get the Format Structure        */
 /********************************************/
@@ -412,6 +660,35 @@ Result<GDAL_Disk_Image_Impl::DatasetPtrT> GDAL_Disk_Image_Impl::get_dataset_ptr(
     }
 }
 
+/************************************************************/
+/*          Find the native block matching a region         */
+/************************************************************/
+std::optional<math::Point2i> GDAL_Disk_Image_Impl::native_block_index( const math::Rect2i& bbox ) const
+{
+    const int block_cols = m_native_blocksize.width();
+    const int block_rows = m_native_blocksize.height();
+    if( block_cols <= 0 || block_rows <= 0 ||
+        block_cols != m_blocksize.width() ||
+        block_rows != m_blocksize.height() ||
+        bbox.min().x() < 0 || bbox.min().y() < 0 ||
+        bbox.min().x() % block_cols != 0 ||
+        bbox.min().y() % block_rows != 0 )
+    {
+        return std::nullopt;
+    }
+
+    // Blocks on the right and bottom edges are clipped to the image
+    const int cols = static_cast<int>( format().cols() );
+    const int rows = static_cast<int>( format().rows() );
+    if( bbox.width()  != std::min( block_cols, cols - bbox.min().x() ) ||
+        bbox.height() != std::min( block_rows, rows - bbox.min().y() ) )
+    {
+        return std::nullopt;
+    }
+    return math::Point2i( { bbox.min().x() / block_cols,
+                            bbox.min().y() / block_rows } );
+}
+
 /************************************************/
 /*          Get the default block size          */
 /************************************************/
@@ -498,6 +775,61 @@ void GDAL_Disk_Image_Impl::set_nodata_write( double value )
     }
 }
 
+/************************************************/
+/*          Check if a region is empty          */
+/************************************************/
+bool GDAL_Disk_Image_Impl::is_empty( const math::Rect2i& bbox ) const
+{
+    std::unique_lock<std::mutex> lock( get_master_gdal_mutex() );
+    auto dataset = get_dataset_ptr();
+    if( dataset.has_error() || !dataset.value() )
+    {
+        return false;
+    }
+
+    // Drivers without coverage information report DATA|UNIMPLEMENTED, so a region
+    // is only empty if every band reports it as such.
+    const int band_count = dataset.value()->GetRasterCount();
+    for( int b = 1; b <= band_count; ++b )
+    {
+        int status = dataset.value()->GetRasterBand( b )->GetDataCoverageStatus( bbox.min().x(),
+                                                                                 bbox.min().y(),
+                                                                                 bbox.width(),
+                                                                                 bbox.height(),
+                                                                                 0,
+                                                                                 nullptr );
+        if( ( status & GDAL_DATA_COVERAGE_STATUS_EMPTY ) == 0 ||
+            ( status & GDAL_DATA_COVERAGE_STATUS_DATA  ) != 0 )
+        {
+            return false;
+        }
+    }
+    return band_count > 0;
+}
+
+/****************************************************/
+/*          Check for data coverage support         */
+/****************************************************/
+bool GDAL_Disk_Image_Impl::has_data_coverage() const
+{
+    std::call_once( m_coverage_checked, [this]() {
+        std::unique_lock<std::mutex> lock( get_master_gdal_mutex() );
+        auto dataset = get_dataset_ptr();
+        if( dataset.has_error() || !dataset.value() || dataset.value()->GetRasterCount() < 1 )
+        {
+            return;
+        }
+        int status = dataset.value()->GetRasterBand( 1 )->GetDataCoverageStatus( 0,
+                                                                                 0,
+                                                                                 dataset.value()->GetRasterXSize(),
+                                                                                 dataset.value()->GetRasterYSize(),
+                                                                                 0,
+                                                                                 nullptr );
+        m_has_coverage = ( status & GDAL_DATA_COVERAGE_STATUS_UNIMPLEMENTED ) == 0;
+    });
+    return m_has_coverage;
+}
+
 /************************************************/
 /*          Flush and Write Everything          */
 /************************************************/
@@ -515,9 +847,33 @@ void GDAL_Disk_Image_Impl::flush()
 /************************************/
 meta::Metadata_Container_Base::ptr_t GDAL_Disk_Image_Impl::metadata() const
 {
+    std::call_once( m_metadata_loaded, [this]() {
+        std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+        if( m_read_dataset )
+        {
+            process_metadata( get_master_gdal_logger(),
+                              m_read_dataset );
+        }
+    });
     return m_metadata;
 }
 
+/********************************************/
+/*          Get a Metadata Domain           */
+/********************************************/
+Result<meta::Metadata_Container_Base::ptr_t> GDAL_Disk_Image_Impl::domain_metadata( const std::string& domain ) const
+{
+    std::unique_lock<std::mutex> lck( get_master_gdal_mutex() );
+    if( !m_read_dataset )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "GDAL:  No dataset opened for reading." );
+    }
+    return outcome::ok<meta::Metadata_Container_Base::ptr_t>( domain_metadata_locked( get_master_gdal_logger(),
+                                                                                      m_read_dataset,
+                                                                                      domain ) );
+}
+
 /************************************************************************************/
 /*          Get the list of supported/trusted drivers that rely on blocksizes       */
 /************************************************************************************/
@@ -738,7 +1094,7 @@ void GDAL_Disk_Image_Impl::configure_for_writing( const Image_Format&
 /*          Process Metadata            */
 /****************************************/
 void GDAL_Disk_Image_Impl::process_metadata( log::Logger&                 logger,
-                                             std::shared_ptr<GDALDataset> dataset )
+                                             std::shared_ptr<GDALDataset> dataset ) const
 {
     const bool DO_NOT_OVERWRITE { false };
 
@@ -749,72 +1105,80 @@ void GDAL_Disk_Image_Impl::process_metadata( log::Logger&                 logger
     auto metadata_domains = dataset->GetMetadataDomainList();
     logger.trace( "Domains: ", CSLCount( metadata_domains ) );
     std::vector<std::string> domain_list;
-    if( CSLCount( metadata_domains ) > 0 )
+    for( int i = 0; i < CSLCount( metadata_domains ); i++ )
     {
-        std::stringstream sout;
-        sout << "Domain Items, Count: " << CSLCount( metadata_domains ) << std::endl;
-        for( int i = 0; i < CSLCount( metadata_domains ); i++ )
-        {
-            domain_list.push_back( CSLGetField( metadata_domains, i ) );
-            sout << "\t\t[" << domain_list.back() << "]" << std::endl;
-        }
-        logger.trace( sout.str() );
+        domain_list.push_back( CSLGetField( metadata_domains, i ) );
     }
+    CSLDestroy( metadata_domains );
 
-    char** metadata = dataset->GetMetadata();
-    logger.trace( "Count: ", CSLCount(metadata) );
-
-    if( CSLCount(metadata) > 0 )
+    // Only the ISIS3 label is merged into the container, other domains are parsed on request
+    if( std::find( domain_list.begin(), domain_list.end(), "json:ISIS3" ) != domain_list.end() )
     {
-        std::stringstream sout;
-        sout << "Metadata Items, Count: " << CSLCount( metadata ) << std::endl;
-        for( int i = 0; i < CSLCount( metadata ); i++ )
-        {
-            sout << "\t\t" << CSLGetField( metadata, i ) << std::endl;
-        }
-        logger.trace( sout.str() );
+        m_metadata->insert( domain_metadata_locked( logger, dataset, "json:ISIS3" ),
+                            DO_NOT_OVERWRITE );
     }
 
-    for( const auto& domain : domain_list )
+    logger.trace( "Driver: ", dataset->GetDriver()->GetDescription(),
+                  ", ", dataset->GetDriver()->GetMetadataItem( GDAL_DMD_LONGNAME ) );
+    m_metadata->insert( "gdal.driver.name_short", dataset->GetDriver()->GetDescription() );
+    m_metadata->insert( "file_driver", dataset->GetDriver()->GetDescription() );
+    m_metadata->insert( "gdal.driver.name_long",  dataset->GetDriver()->GetMetadataItem( GDAL_DMD_LONGNAME ) );
+
+    logger.trace( "Image Size: ", dataset->GetRasterXSize(), " cols, ",
+                  dataset->GetRasterYSize(), " rows, ", dataset->GetRasterCount(),
+                  " channels" );
+}
+
+/********************************************/
+/*          Parse a Metadata Domain         */
+/********************************************/
+meta::Metadata_Container_Base::ptr_t GDAL_Disk_Image_Impl::domain_metadata_locked( log::Logger&                 logger,
+                                                                                   std::shared_ptr<GDALDataset> dataset,
+                                                                                   const std::string&           domain ) const
+{
+    const bool DO_NOT_OVERWRITE { false };
+
+    auto it = m_domain_metadata.find( domain );
+    if( it != m_domain_metadata.end() )
     {
-        char** dmetadata = dataset->GetMetadata( domain.c_str() );
-        logger.trace( "Count: ", CSLCount( dmetadata ) );
+        return it->second;
+    }
 
-        if( CSLCount( dmetadata ) > 0 && domain != "json:ISIS3" )
+    auto container = std::make_shared<meta::Metadata_Container_Base>();
+    char** dmetadata = dataset->GetMetadata( domain.empty() ? nullptr : domain.c_str() );
+    logger.trace( "Domain [", domain, "] Count: ", CSLCount( dmetadata ) );
+
+    if( domain == "json:ISIS3" )
+    {
+        logger.debug( "Parsing ISIS3 JSON Node" );
+        for( int i = 0; i < CSLCount( dmetadata ); i++ )
         {
-            std::stringstream sout;
-            sout << "Domain [" << domain << "] Metadata Items, Count: " << CSLCount( dmetadata ) << std::endl;
-            for( int i = 0; i < CSLCount( dmetadata ); i++ )
+            auto result = ISIS_JSON_Parser::parse( CSLGetField( dmetadata, i ) );
+            if( result.has_error() )
             {
-                sout << "\t\t" << CSLGetField( dmetadata, i ) << std::endl;
+                logger.error( "Trouble parsing ISIS JSON data.",
+                              result.error().message() );
+                continue;
             }
-            logger.trace( sout.str() );
+            container->insert( result.value(), DO_NOT_OVERWRITE );
         }
-        else if( domain == "json:ISIS3" )
+    }
+    else
+    {
+        for( int i = 0; i < CSLCount( dmetadata ); i++ )
         {
-            logger.debug( "Parsing ISIS3 JSON Node" );
-            for( int i = 0; i < CSLCount( dmetadata ); i++ )
+            char* key = nullptr;
+            const char* value = CPLParseNameValue( CSLGetField( dmetadata, i ), &key );
+            if( key != nullptr && value != nullptr )
             {
-                auto result = ISIS_JSON_Parser::parse( CSLGetField( dmetadata, i ) );
-                if( result.has_error() )
-                {
-                    logger.error( "Trouble parsing ISIS JSON data.",
-                                  result.error().message() );
-                }
-                m_metadata->insert( result.value(), DO_NOT_OVERWRITE );
+                container->insert( std::string( key ), std::string( value ) );
             }
+            CPLFree( key );
         }
     }
 
-    logger.trace( "Driver: ", dataset->GetDriver()->GetDescription(),
-                  ", ", dataset->GetDriver()->GetMetadataItem( GDAL_DMD_LONGNAME ) );
-    m_metadata->insert( "gdal.driver.name_short", dataset->GetDriver()->GetDescription() );
-    m_metadata->insert( "file_driver", dataset->GetDriver()->GetDescription() );
-    m_metadata->insert( "gdal.driver.name_long",  dataset->GetDriver()->GetMetadataItem( GDAL_DMD_LONGNAME ) );
-
-    logger.trace( "Image Size: ", dataset->GetRasterXSize(), " cols, ",
-                  dataset->GetRasterYSize(), " rows, ", dataset->GetRasterCount(),
-                  " channels" );
+    m_domain_metadata[domain] = container;
+    return container;
 }
 
 } // End of tmns::image::io::gdal namespace
\ No newline at end of file
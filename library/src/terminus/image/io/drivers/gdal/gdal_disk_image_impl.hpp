@@ -21,6 +21,8 @@
 // C++ Libraries
 #include <filesystem>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <tuple>
 #include <vector>
 
@@ -33,6 +35,7 @@
 // Terminus Libraries
 #include <terminus/image/metadata/metadata_container_base.hpp>
 #include <terminus/image/pixel/channel_type_enum.hpp>
+#include <terminus/image/pixel/palette.hpp>
 #include <terminus/image/pixel/pixel_rgba.hpp>
 #include <terminus/image/types/image_buffer.hpp>
 #include <terminus/image/types/image_format.hpp>
@@ -76,6 +79,29 @@ class GDAL_Disk_Image_Impl
                            const math::Rect2i&  bbox,
                            bool                 rescale ) const;
 
+        /**
+         * Read a single native block with GDALRasterBand::ReadBlock().  The block is
+         * decoded straight from the file and never enters GDAL's block cache.
+         *
+         * Falls back to RasterIO when block_read_size() differs from the file's
+         * block size, or the image has a palette.
+        */
+        Result<void> read_block( int                 ix,
+                                 int                 iy,
+                                 const Image_Buffer& dest,
+                                 bool                rescale ) const;
+
+        /**
+         * Read the raw indices of a paletted image, without expanding them
+        */
+        Result<void> read_indices( const Image_Buffer&  dest,
+                                   const math::Rect2i&  bbox ) const;
+
+        /**
+         * Get the color palette, or null if the image has none
+        */
+        Palette::ptr_t palette() const;
+
         /**
          * Write the resource to disk
         */
@@ -133,16 +159,32 @@ class GDAL_Disk_Image_Impl
         */
         void set_nodata_write( double value );
 
+        /**
+         * Check if every band reports the region as empty (sparse) data coverage
+        */
+        bool is_empty( const math::Rect2i& bbox ) const;
+
+        /**
+         * Check if the driver provides data coverage information, so is_empty()
+         * can ever return true.  Checked once per dataset.
+        */
+        bool has_data_coverage() const;
+
         /**
          * Flush the image
         */
         void flush();
 
         /**
-         * Get the internal metadata container
+         * Get the internal metadata container.  Dataset metadata is read on the first call.
          */
         meta::Metadata_Container_Base::ptr_t metadata() const;
 
+        /**
+         * Get the metadata for a single GDAL metadata domain, parsing it on first request.
+         */
+        Result<meta::Metadata_Container_Base::ptr_t> domain_metadata( const std::string& domain ) const;
+
         /**
          * Check if driver type is trusted to report valid single-line block sizes
         */
@@ -159,6 +201,36 @@ class GDAL_Disk_Image_Impl
 
         void  initialize_write_resource_locked();
 
+        /**
+         * Read a region through RasterIO, and so through GDAL's block cache
+        */
+        Result<void> read_raster( const Image_Buffer&  dest,
+                                  const math::Rect2i&  bbox,
+                                  bool                 rescale ) const;
+
+        /**
+         * Convert raw file data into the read destination.  Masked destinations
+         * get their validity channel from the nodata value in the same call.
+        */
+        Result<void> convert_read( const Image_Buffer& dest,
+                                   const Image_Buffer& src,
+                                   bool                rescale ) const;
+
+        /**
+         * Read palette indices from band 1 into a strided 8-bit buffer.  Must hold
+         * the master GDAL mutex.
+        */
+        CPLErr read_indices_locked( std::shared_ptr<GDALDataset> dataset,
+                                    const math::Rect2i&          bbox,
+                                    uint8_t*                     data,
+                                    size_t                       cstride,
+                                    size_t                       rstride ) const;
+
+        /**
+         * Get the index of the native block covering exactly this region, if any
+        */
+        std::optional<math::Point2i> native_block_index( const math::Rect2i& bbox ) const;
+
         /**
          * Check the driver to see if the nodata read value was acceptable
         */
@@ -172,10 +244,17 @@ class GDAL_Disk_Image_Impl
                                     const math::Size2i&                      block_size );
 
         /**
-         * Process Dataset Metadata
+         * Process Dataset Metadata.  Must hold the master GDAL mutex.
          */
         void process_metadata( log::Logger&                 logger,
-                               std::shared_ptr<GDALDataset> dataset );
+                               std::shared_ptr<GDALDataset> dataset ) const;
+
+        /**
+         * Parse a single metadata domain.  Must hold the master GDAL mutex.
+         */
+        meta::Metadata_Container_Base::ptr_t domain_metadata_locked( log::Logger&                 logger,
+                                                                     std::shared_ptr<GDALDataset> dataset,
+                                                                     const std::string&           domain ) const;
 
         /// Pathname to image
         std::filesystem::path m_pathname;
@@ -193,8 +272,11 @@ class GDAL_Disk_Image_Impl
         /// Block Size Information
         math::Size2i m_blocksize;
 
-        /// Image Palette
-        std::vector<PixelRGBA_u8> m_color_table;
+        /// Block size of the file itself
+        math::Size2i m_native_blocksize {{ 0, 0 }};
+
+        /// Image Palette, null if the image has none
+        Palette::ptr_t m_palette;
 
         // Base Driver Options
         Options  m_driver_options;
@@ -202,6 +284,18 @@ class GDAL_Disk_Image_Impl
         /// Metadata Container
         meta::Metadata_Container_Base::ptr_t m_metadata { std::make_shared<meta::Metadata_Container_Base>() };
 
+        /// Guards the one-time load of the dataset metadata
+        mutable std::once_flag m_metadata_loaded;
+
+        /// Guards the one-time data coverage check
+        mutable std::once_flag m_coverage_checked;
+
+        /// Whether the driver reports data coverage
+        mutable bool m_has_coverage { false };
+
+        /// Parsed metadata domains, protected by the master GDAL mutex
+        mutable std::map<std::string,meta::Metadata_Container_Base::ptr_t> m_domain_metadata;
+
 }; // End of GDAL_Disk_Image_Impl class
 
 }
\ No newline at end of file
@@ -73,11 +73,6 @@ Result<Image_Resource_Disk_GDAL::ParentPtrT>
         Image_Resource_Disk_GDAL::create( const std::filesystem::path& pathname )
 {
     auto driver = std::make_shared<Image_Resource_Disk_GDAL>( pathname );
-
-    // Update Metadata
-    driver->metadata()->insert( driver->m_impl->metadata(),
-                                        true );
-
     return outcome::ok<ParentPtrT>( driver );
 }
 
@@ -96,11 +91,6 @@ Result<Image_Resource_Disk_GDAL::ParentPtrT>
                                                               write_options,
                                                               block_size,
                                                               color_reference_lut );
-
-    // Update Metadata
-    driver->metadata()->insert( driver->m_impl->metadata(),
-                                        true );
-
     return outcome::ok<ParentPtrT>( driver );
 }
 
@@ -118,13 +108,54 @@ Result<void> Image_Resource_Disk_GDAL::open( const std::filesystem::path& pathna
 Result<void> Image_Resource_Disk_GDAL::read( const Image_Buffer& dest,
                                              const math::Rect2i& bbox ) const
 {
-    auto result = m_impl->read( dest, bbox, m_rescale );
+    return m_impl->read( dest, bbox, m_rescale );
+}
+
+/****************************************/
+/*          Get the Metadata            */
+/****************************************/
+meta::Metadata_Container_Base::ptr_t Image_Resource_Disk_GDAL::metadata() const
+{
+    std::call_once( m_metadata_merged, [this]() {
+        m_metadata->insert( m_impl->metadata(),
+                            true );
+    });
+    return m_metadata;
+}
+
+/********************************************/
+/*          Get a Metadata Domain           */
+/********************************************/
+Result<meta::Metadata_Container_Base::ptr_t> Image_Resource_Disk_GDAL::domain_metadata( const std::string& domain ) const
+{
+    return m_impl->domain_metadata( domain );
+}
 
-    // Process metadata
-    metadata()->insert( m_impl->metadata(),
-                        true );
+/************************************************/
+/*          Read raw palette indices            */
+/************************************************/
+Result<void> Image_Resource_Disk_GDAL::read_indices( const Image_Buffer& dest,
+                                                     const math::Rect2i& bbox ) const
+{
+    return m_impl->read_indices( dest, bbox );
+}
 
-    return result;
+/****************************************/
+/*          Get the color palette       */
+/****************************************/
+Palette::ptr_t Image_Resource_Disk_GDAL::palette() const
+{
+    return m_impl->palette();
+}
+
+/****************************************************/
+/*          Read a single native block              */
+/****************************************************/
+Result<void> Image_Resource_Disk_GDAL::read_block( int                 ix,
+                                                   int                 iy,
+                                                   const Image_Buffer& dest ) const
+{
+    return m_impl->read_block( ix, iy, dest, m_rescale );
 }
 
 /****************************************************/
@@ -154,6 +185,14 @@ bool Image_Resource_Disk_GDAL::has_block_read() const
     return true;
 }
 
+/*********************************************/
+/*      Check if Concurrent Read Supported   */
+/*********************************************/
+bool Image_Resource_Disk_GDAL::has_concurrent_read() const
+{
+    return true;
+}
+
 /*********************************************/
 /*      Check if Block Write Supported       */
 /*********************************************/
@@ -210,6 +249,22 @@ double Image_Resource_Disk_GDAL::nodata_read() const
     return m_impl->nodata_read();
 }
 
+/************************************************/
+/*          Check if a region is empty          */
+/************************************************/
+bool Image_Resource_Disk_GDAL::is_empty( const math::Rect2i& bbox ) const
+{
+    return m_impl->is_empty( bbox );
+}
+
+/****************************************************/
+/*          Check if empty regions are reported     */
+/****************************************************/
+bool Image_Resource_Disk_GDAL::has_empty_regions() const
+{
+    return m_impl->has_data_coverage();
+}
+
 /****************************************/
 /*      Set the nodata write value      */
 /****************************************/
@@ -0,0 +1,246 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    envi_header.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include "envi_header.hpp"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// C++ Libraries
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace tmns::image::io::raw {
+
+namespace {
+
+/**
+ * ENVI "data type" codes
+*/
+const std::map<int,Channel_Type_Enum>& envi_data_types()
+{
+    static const std::map<int,Channel_Type_Enum> data_types {
+        {  1, Channel_Type_Enum::UINT8   },
+        {  2, Channel_Type_Enum::INT16   },
+        {  3, Channel_Type_Enum::INT32   },
+        {  4, Channel_Type_Enum::FLOAT32 },
+        {  5, Channel_Type_Enum::FLOAT64 },
+        { 12, Channel_Type_Enum::UINT16  },
+        { 13, Channel_Type_Enum::UINT32  },
+        { 14, Channel_Type_Enum::INT64   },
+        { 15, Channel_Type_Enum::UINT64  } };
+    return data_types;
+}
+
+} // End of anonymous namespace
+
+/****************************************/
+/*      Convert Interleave to String    */
+/****************************************/
+std::string enum_to_string( Interleave val )
+{
+    switch( val )
+    {
+        case Interleave::BSQ: return "bsq";
+        case Interleave::BIL: return "bil";
+        case Interleave::BIP: return "bip";
+    }
+    return "unknown";
+}
+
+/********************************************/
+/*          Parse an ENVI Header            */
+/********************************************/
+Result<ENVI_Header> ENVI_Header::read( const std::filesystem::path& header_path )
+{
+    std::ifstream fin( header_path );
+    if( !fin.is_open() )
+    {
+        return outcome::fail( error::Error_Code::FILE_NOT_FOUND,
+                              "Unable to open ENVI header: ", header_path.native() );
+    }
+
+    std::string line;
+    std::getline( fin, line );
+    boost::trim( line );
+    if( line != "ENVI" )
+    {
+        return outcome::fail( error::Error_Code::PARSING_ERROR,
+                              "Not an ENVI header: ", header_path.native() );
+    }
+
+    ENVI_Header header;
+    bool have_samples = false;
+    bool have_lines   = false;
+    bool have_type    = false;
+    while( std::getline( fin, line ) )
+    {
+        auto pos = line.find( '=' );
+        if( pos == std::string::npos )
+        {
+            continue;
+        }
+        std::string key   = boost::to_lower_copy( boost::trim_copy( line.substr( 0, pos ) ) );
+        std::string value = boost::to_lower_copy( boost::trim_copy( line.substr( pos + 1 ) ) );
+
+        // Multi-line "{...}" values are not needed, so skip past them
+        if( !value.empty() && value.front() == '{' )
+        {
+            while( value.find( '}' ) == std::string::npos && std::getline( fin, line ) )
+            {
+                value += line;
+            }
+            continue;
+        }
+
+        try
+        {
+            if( key == "samples" )
+            {
+                header.samples = std::stoul( value );
+                have_samples = true;
+            }
+            else if( key == "lines" )
+            {
+                header.lines = std::stoul( value );
+                have_lines = true;
+            }
+            else if( key == "bands" )
+            {
+                header.bands = std::stoul( value );
+            }
+            else if( key == "header offset" )
+            {
+                header.header_offset = std::stoul( value );
+            }
+            else if( key == "byte order" )
+            {
+                header.big_endian = ( std::stoi( value ) == 1 );
+            }
+            else if( key == "data type" )
+            {
+                auto it = envi_data_types().find( std::stoi( value ) );
+                if( it == envi_data_types().end() )
+                {
+                    return outcome::fail( error::Error_Code::INVALID_CHANNEL_TYPE,
+                                          "Unsupported ENVI data type: ", value );
+                }
+                header.channel_type = it->second;
+                have_type = true;
+            }
+            else if( key == "interleave" )
+            {
+                if( value == "bsq" )      { header.interleave = Interleave::BSQ; }
+                else if( value == "bil" ) { header.interleave = Interleave::BIL; }
+                else if( value == "bip" ) { header.interleave = Interleave::BIP; }
+                else
+                {
+                    return outcome::fail( error::Error_Code::PARSING_ERROR,
+                                          "Unsupported ENVI interleave: ", value );
+                }
+            }
+        }
+        catch( const std::exception& e )
+        {
+            return outcome::fail( error::Error_Code::PARSING_ERROR,
+                                  "Unable to parse ENVI header entry '", key, "': ", e.what() );
+        }
+    }
+
+    if( !have_samples || !have_lines || !have_type || header.bands == 0 )
+    {
+        return outcome::fail( error::Error_Code::PARSING_ERROR,
+                              "ENVI header is missing samples, lines, bands, or data type: ",
+                              header_path.native() );
+    }
+    return outcome::ok<ENVI_Header>( header );
+}
+
+/********************************************/
+/*          Write the Header to Disk        */
+/********************************************/
+Result<void> ENVI_Header::write( const std::filesystem::path& header_path ) const
+{
+    int data_type = -1;
+    for( const auto& [code, ctype] : envi_data_types() )
+    {
+        if( ctype == channel_type )
+        {
+            data_type = code;
+        }
+    }
+    if( data_type < 0 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_CHANNEL_TYPE,
+                              "Channel type ", enum_to_string( channel_type ),
+                              " has no ENVI equivalent" );
+    }
+
+    std::ofstream fout( header_path );
+    if( !fout.is_open() )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to write ENVI header: ", header_path.native() );
+    }
+    fout << "ENVI" << std::endl;
+    fout << "samples = " << samples << std::endl;
+    fout << "lines = " << lines << std::endl;
+    fout << "bands = " << bands << std::endl;
+    fout << "header offset = " << header_offset << std::endl;
+    fout << "file type = ENVI Standard" << std::endl;
+    fout << "data type = " << data_type << std::endl;
+    fout << "interleave = " << enum_to_string( interleave ) << std::endl;
+    fout << "byte order = " << ( big_endian ? 1 : 0 ) << std::endl;
+    return outcome::ok();
+}
+
+/************************************************/
+/*          Get the sidecar header path         */
+/************************************************/
+std::filesystem::path ENVI_Header::header_path( const std::filesystem::path& data_path )
+{
+    auto replaced = data_path;
+    replaced.replace_extension( ".hdr" );
+    if( std::filesystem::exists( replaced ) )
+    {
+        return replaced;
+    }
+
+    auto appended = data_path;
+    appended += ".hdr";
+    if( std::filesystem::exists( appended ) )
+    {
+        return appended;
+    }
+    return replaced;
+}
+
+/************************************************/
+/*          Print to log-friendly string        */
+/************************************************/
+std::string ENVI_Header::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << " - ENVI_Header" << std::endl;
+    sout << gap << "   - samples: " << samples << ", lines: " << lines << ", bands: " << bands << std::endl;
+    sout << gap << "   - header offset: " << header_offset << std::endl;
+    sout << gap << "   - interleave: " << enum_to_string( interleave ) << std::endl;
+    sout << gap << "   - channel type: " << enum_to_string( channel_type ) << std::endl;
+    sout << gap << "   - big endian: " << std::boolalpha << big_endian << std::endl;
+    return sout.str();
+}
+
+} // End of tmns::image::io::raw namespace
@@ -0,0 +1,95 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    envi_header.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// External Terminus Libraries
+#include <terminus/error.hpp>
+
+// Terminus Libraries
+#include <terminus/image/pixel/channel_type_enum.hpp>
+
+// C++ Libraries
+#include <filesystem>
+#include <string>
+
+namespace tmns::image::io::raw {
+
+/**
+ * Band layout of a raw raster on disk
+*/
+enum class Interleave
+{
+    BSQ = 0 /**< Band sequential.  Each band is a full image.*/,
+    BIL = 1 /**< Band interleaved by line.  Each row holds one line of every band.*/,
+    BIP = 2 /**< Band interleaved by pixel.  Each pixel holds every band.*/,
+}; // End of Interleave enumeration
+
+/**
+ * Convert Interleave to a string
+*/
+std::string enum_to_string( Interleave val );
+
+/**
+ * Subset of an ENVI ".hdr" sidecar needed to describe an uncompressed raster.
+*/
+class ENVI_Header
+{
+    public:
+
+        /// Image Columns
+        size_t samples { 0 };
+
+        /// Image Rows
+        size_t lines { 0 };
+
+        /// Number of bands
+        size_t bands { 1 };
+
+        /// Bytes to skip at the start of the data file
+        size_t header_offset { 0 };
+
+        /// Band layout
+        Interleave interleave { Interleave::BSQ };
+
+        /// Channel type
+        Channel_Type_Enum channel_type { Channel_Type_Enum::UINT8 };
+
+        /// True if the data is big-endian
+        bool big_endian { false };
+
+        /**
+         * Parse an ENVI header
+        */
+        static Result<ENVI_Header> read( const std::filesystem::path& header_path );
+
+        /**
+         * Write the header to disk
+        */
+        Result<void> write( const std::filesystem::path& header_path ) const;
+
+        /**
+         * Get the sidecar header path for a data file.  Prefers an existing "name.hdr",
+         * then "name.ext.hdr", then returns "name.hdr" for new files.
+        */
+        static std::filesystem::path header_path( const std::filesystem::path& data_path );
+
+        /**
+         * Print to log-friendly string
+        */
+        std::string to_log_string( size_t offset ) const;
+
+}; // End of ENVI_Header class
+
+} // End of tmns::image::io::raw namespace
@@ -0,0 +1,673 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    image_resource_disk_raw.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <terminus/image/io/drivers/raw/image_resource_disk_raw.hpp>
+
+// Terminus Libraries
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/pixel/pixel_format_enum.hpp>
+#include <terminus/image/types/async_read_queue.hpp>
+#include <terminus/log/utility.hpp>
+#include "envi_header.hpp"
+#include "uring_reader.hpp"
+
+// POSIX Libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ Libraries
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+namespace tmns::image::io::raw {
+namespace {
+
+/// Largest single read handed to io_uring once contiguous rows are merged
+const size_t MAX_MERGED_READ_BYTES = 8 * 1024 * 1024;
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Image_Resource_Disk_Raw::Image_Resource_Disk_Raw( const std::filesystem::path& pathname )
+  : Image_Resource_Disk( pathname )
+{
+}
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Image_Resource_Disk_Raw::Image_Resource_Disk_Raw( const std::filesystem::path&                              pathname,
+                                                  const Image_Format&                                       output_format,
+                                                  [[maybe_unused]] const std::map<std::string,std::string>& write_options,
+                                                  const math::Size2i&                                       block_size )
+  : Image_Resource_Disk( pathname ),
+    m_format( output_format ),
+    m_block_size( block_size )
+{
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Image_Resource_Disk_Raw::~Image_Resource_Disk_Raw()
+{
+    flush();
+    m_mapping.reset();
+    m_uring.reset();
+    if( m_fd >= 0 )
+    {
+        ::close( m_fd );
+    }
+}
+
+/********************************************/
+/*          Get the resource name           */
+/********************************************/
+std::string Image_Resource_Disk_Raw::resource_name() const
+{
+    return "Raw";
+}
+
+/****************************************************/
+/*          Create Resource and Open Image          */
+/****************************************************/
+Result<Image_Resource_Disk_Raw::ParentPtrT>
+        Image_Resource_Disk_Raw::create( const std::filesystem::path& pathname )
+{
+    auto header = ENVI_Header::read( ENVI_Header::header_path( pathname ) );
+    if( header.has_error() )
+    {
+        return outcome::fail( header.error() );
+    }
+
+    auto driver = std::make_shared<Image_Resource_Disk_Raw>( pathname );
+    auto open_res = driver->open( header.value(), false );
+    if( open_res.has_error() )
+    {
+        return outcome::fail( open_res.error() );
+    }
+    return outcome::ok<ParentPtrT>( driver );
+}
+
+/****************************************************/
+/*          Create Resource and Open Image          */
+/****************************************************/
+Result<Image_Resource_Disk_Raw::ParentPtrT>
+        Image_Resource_Disk_Raw::create( const std::filesystem::path&             pathname,
+                                         const Image_Format&                      output_format,
+                                         const std::map<std::string,std::string>& write_options,
+                                         const math::Size2i&                      block_size )
+{
+    auto channels = num_channels( output_format.pixel_type() );
+    if( channels.has_error() )
+    {
+        return outcome::fail( channels.error() );
+    }
+    if( channels.value() > 1 && output_format.planes() > 1 )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Raw rasters cannot store multi-plane, multi-channel images" );
+    }
+
+    // Multi-channel pixels are stored pixel-interleaved, planes are stored band-sequential
+    ENVI_Header header;
+    header.samples      = output_format.cols();
+    header.lines        = output_format.rows();
+    header.bands        = std::max<size_t>( output_format.planes(), channels.value() );
+    header.interleave   = ( channels.value() > 1 ) ? Interleave::BIP : Interleave::BSQ;
+    header.channel_type = output_format.channel_type();
+    header.big_endian   = ( std::endian::native == std::endian::big );
+
+    auto header_res = header.write( ENVI_Header::header_path( pathname ) );
+    if( header_res.has_error() )
+    {
+        return outcome::fail( header_res.error() );
+    }
+
+    auto driver = std::make_shared<Image_Resource_Disk_Raw>( pathname,
+                                                             output_format,
+                                                             write_options,
+                                                             block_size );
+    auto open_res = driver->open( header, true );
+    if( open_res.has_error() )
+    {
+        return outcome::fail( open_res.error() );
+    }
+    return outcome::ok<ParentPtrT>( driver );
+}
+
+/****************************************************/
+/*          Read the image buffer from disk         */
+/****************************************************/
+Result<void> Image_Resource_Disk_Raw::read( const Image_Buffer& dest,
+                                            const math::Rect2i& bbox ) const
+{
+    auto src = buffer( bbox );
+    if( src.has_error() )
+    {
+        return outcome::fail( src.error() );
+    }
+    return convert( dest, src.value(), m_rescale );
+}
+
+/****************************************************/
+/*          Queue a batch of reads                  */
+/****************************************************/
+std::vector<std::future<Result<void>>>
+        Image_Resource_Disk_Raw::read_async( const std::vector<Image_Buffer>& dests,
+                                             const std::vector<math::Rect2i>& bboxes ) const
+{
+    auto reader = uring_reader();
+    if( !reader )
+    {
+        for( const auto& bbox : bboxes )
+        {
+            prefetch( bbox );
+        }
+        return Read_Image_Resource_Base::read_async( dests, bboxes );
+    }
+
+    auto promises = std::make_shared<std::vector<std::promise<Result<void>>>>( dests.size() );
+    std::vector<std::future<Result<void>>> futures;
+    futures.reserve( dests.size() );
+    for( auto& promise : *promises )
+    {
+        futures.push_back( promise.get_future() );
+    }
+
+    // One job hands the whole batch to the ring.  It only touches the file descriptor and
+    // the destinations, so batches may run on several I/O threads at once.  The resource
+    // is kept alive while the batch is pending if it is shared, and by the caller otherwise.
+    std::shared_ptr<const Image_Resource_Disk_Raw> self( weak_from_this().lock(), this );
+    std::vector<Async_Read_Queue::job_type> jobs;
+    jobs.emplace_back( [self, reader, promises, dests, bboxes]() -> Result<void> {
+        self->read_uring( *reader, dests, bboxes, *promises );
+        return outcome::ok(); } );
+    Async_Read_Queue::instance().submit( std::move( jobs ) );
+    return futures;
+}
+
+/****************************************************/
+/*          Write the image buffer to disk          */
+/****************************************************/
+Result<void> Image_Resource_Disk_Raw::write( const Image_Buffer& source,
+                                             const math::Rect2i& bbox )
+{
+    if( !m_writable )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Resource was opened read-only: ", m_pathname.native() );
+    }
+    auto dest = buffer( bbox );
+    if( dest.has_error() )
+    {
+        return outcome::fail( dest.error() );
+    }
+    return convert( dest.value(), source, m_rescale );
+}
+
+/****************************************************/
+/*          Get a buffer into the mapping           */
+/****************************************************/
+Result<Image_Buffer> Image_Resource_Disk_Raw::buffer( const math::Rect2i& bbox ) const
+{
+    if( !m_mapping )
+    {
+        return outcome::fail( error::Error_Code::UNINITIALIZED,
+                              "Resource is not mapped: ", m_pathname.native() );
+    }
+    if( bbox.min().x() < 0 || bbox.min().y() < 0 ||
+        bbox.max().x() > (int)m_format.cols() ||
+        bbox.max().y() > (int)m_format.rows() )
+    {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Region ", bbox.to_string(), " is outside of image bounds ",
+                              m_format.bbox().to_string() );
+    }
+
+    Image_Buffer full( m_data,
+                       m_format,
+                       m_cstride,
+                       m_rstride,
+                       m_pstride );
+    return outcome::ok<Image_Buffer>( full.cropped( bbox ) );
+}
+
+/****************************************/
+/*          Set the Access Pattern      */
+/****************************************/
+void Image_Resource_Disk_Raw::set_access_pattern( Access_Pattern pattern )
+{
+    if( !m_mapping )
+    {
+        return;
+    }
+
+    int advice = MADV_NORMAL;
+    if( pattern == Access_Pattern::SEQUENTIAL )
+    {
+        advice = MADV_SEQUENTIAL;
+    }
+    else if( pattern == Access_Pattern::RANDOM )
+    {
+        advice = MADV_RANDOM;
+    }
+
+    if( madvise( m_mapping.get(), m_mapping_size, advice ) != 0 )
+    {
+        tmns::log::warn( ADD_CURRENT_LOC(), "madvise failed for ", m_pathname.native(),
+                         ": ", std::strerror( errno ) );
+    }
+}
+
+/****************************************/
+/*          Get the pixel data          */
+/****************************************/
+Image_Format Image_Resource_Disk_Raw::format() const
+{
+    return m_format;
+}
+
+/********************************************/
+/*      Check if Block Read Supported       */
+/********************************************/
+bool Image_Resource_Disk_Raw::has_block_read() const
+{
+    return true;
+}
+
+/*********************************************/
+/*      Check if Concurrent Read Supported   */
+/*********************************************/
+bool Image_Resource_Disk_Raw::has_concurrent_read() const
+{
+    return true;
+}
+
+/*********************************************/
+/*      Check if Block Write Supported       */
+/*********************************************/
+bool Image_Resource_Disk_Raw::has_block_write() const
+{
+    return true;
+}
+
+/*********************************************/
+/*      Check if Nodata Read Supported       */
+/*********************************************/
+bool Image_Resource_Disk_Raw::has_nodata_read() const
+{
+    return false;
+}
+
+/**********************************************/
+/*      Check if Nodata Write Supported       */
+/**********************************************/
+bool Image_Resource_Disk_Raw::has_nodata_write() const
+{
+    return false;
+}
+
+/***********************************************/
+/*          Get the block read size            */
+/***********************************************/
+math::Size2i Image_Resource_Disk_Raw::block_read_size() const
+{
+    return block_write_size();
+}
+
+/************************************************/
+/*          Get the block write size            */
+/************************************************/
+math::Size2i Image_Resource_Disk_Raw::block_write_size() const
+{
+    if( m_block_size.width() > 0 && m_block_size.height() > 0 )
+    {
+        return m_block_size;
+    }
+
+    // Full-width strips of roughly 2 MB
+    const size_t row_bytes = std::max<size_t>( m_format.cols() * m_format.planes() * channel_size_bytes( m_format.channel_type() ).value(), 1 );
+    const size_t block_rows = std::clamp<size_t>( ( 2 * 1024 * 1024 ) / row_bytes, 1, std::max<size_t>( m_format.rows(), 1 ) );
+    return math::Size2i( { (int)m_format.cols(), (int)block_rows } );
+}
+
+/************************************************/
+/*          Set the block write size            */
+/************************************************/
+void Image_Resource_Disk_Raw::set_block_write_size( const math::Size2i& block_size )
+{
+    m_block_size = block_size;
+}
+
+/****************************************/
+/*          Get the native pointer      */
+/****************************************/
+std::shared_ptr<const uint8_t[]> Image_Resource_Disk_Raw::native_ptr() const
+{
+    // Only band-sequential data matches the packed layout callers expect
+    if( !m_mapping || m_pstride != m_format.rows() * m_rstride )
+    {
+        return Read_Image_Resource_Base::native_ptr();
+    }
+    return std::shared_ptr<const uint8_t[]>( m_mapping, m_data );
+}
+
+/****************************************/
+/*          Get the native size         */
+/****************************************/
+size_t Image_Resource_Disk_Raw::native_size() const
+{
+    return m_format.raster_size_bytes();
+}
+
+/****************************/
+/*          Flush           */
+/****************************/
+void Image_Resource_Disk_Raw::flush()
+{
+    if( m_mapping && m_writable )
+    {
+        if( msync( m_mapping.get(), m_mapping_size, MS_SYNC ) != 0 )
+        {
+            tmns::log::warn( ADD_CURRENT_LOC(), "msync failed for ", m_pathname.native(),
+                             ": ", std::strerror( errno ) );
+        }
+    }
+}
+
+/************************************************/
+/*          Print to log-friendly string        */
+/************************************************/
+std::string Image_Resource_Disk_Raw::to_log_string( size_t offset ) const
+{
+    std::string gap( offset, ' ' );
+    std::stringstream sout;
+    sout << gap << " - Image_Resource_Disk_Raw" << std::endl;
+    sout << gap << "   - pathname: " << m_pathname.native() << std::endl;
+    sout << gap << "   - mapped: " << std::boolalpha << (m_mapping != nullptr) << ", writable: " << m_writable << std::endl;
+    sout << gap << "   - strides: " << m_cstride << ", " << m_rstride << ", " << m_pstride << std::endl;
+    sout << m_format.to_string( offset + 4 );
+    return sout.str();
+}
+
+/****************************************/
+/*          Map the Data File           */
+/****************************************/
+Result<void> Image_Resource_Disk_Raw::open( const ENVI_Header& header,
+                                            bool               writable )
+{
+    if( header.big_endian != ( std::endian::native == std::endian::big ) )
+    {
+        return outcome::fail( error::Error_Code::NOT_IMPLEMENTED,
+                              "Byte-swapped raw rasters are not supported: ", m_pathname.native() );
+    }
+
+    auto channel_bytes = channel_size_bytes( header.channel_type );
+    if( channel_bytes.has_error() )
+    {
+        return outcome::fail( channel_bytes.error() );
+    }
+    const size_t b = channel_bytes.value();
+    const size_t data_size = header.samples * header.lines * header.bands * b;
+    const size_t file_size = header.header_offset + data_size;
+
+    int fd = writable ? ::open( m_pathname.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 )
+                      : ::open( m_pathname.c_str(), O_RDONLY );
+    if( fd < 0 )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to open ", m_pathname.native(), ": ", std::strerror( errno ) );
+    }
+
+    if( writable )
+    {
+        if( ftruncate( fd, file_size ) != 0 )
+        {
+            ::close( fd );
+            return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                                  "Unable to size ", m_pathname.native(), ": ", std::strerror( errno ) );
+        }
+    }
+    else
+    {
+        struct stat st;
+        if( fstat( fd, &st ) != 0 || (size_t)st.st_size < file_size )
+        {
+            ::close( fd );
+            return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                                  "File ", m_pathname.native(), " is smaller than its header describes (",
+                                  file_size, " bytes)" );
+        }
+    }
+
+    void* addr = mmap( nullptr,
+                       file_size,
+                       writable ? ( PROT_READ | PROT_WRITE ) : PROT_READ,
+                       MAP_SHARED,
+                       fd,
+                       0 );
+    if( addr == MAP_FAILED )
+    {
+        ::close( fd );
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to map ", m_pathname.native(), ": ", std::strerror( errno ) );
+    }
+
+    m_mapping_size = file_size;
+    m_mapping      = std::shared_ptr<uint8_t>( static_cast<uint8_t*>( addr ),
+                                               [file_size]( uint8_t* ptr ){ munmap( ptr, file_size ); } );
+    m_data         = m_mapping.get() + header.header_offset;
+    m_data_offset  = header.header_offset;
+    m_fd           = fd;
+    m_writable     = writable;
+    m_format       = Image_Format( header.samples,
+                                   header.lines,
+                                   header.bands,
+                                   Pixel_Format_Enum::SCALAR,
+                                   header.channel_type,
+                                   false );
+
+    switch( header.interleave )
+    {
+        case Interleave::BSQ:
+            m_cstride = b;
+            m_rstride = b * header.samples;
+            m_pstride = b * header.samples * header.lines;
+            break;
+        case Interleave::BIL:
+            m_cstride = b;
+            m_rstride = b * header.samples * header.bands;
+            m_pstride = b * header.samples;
+            break;
+        case Interleave::BIP:
+            m_cstride = b * header.bands;
+            m_rstride = b * header.samples * header.bands;
+            m_pstride = b;
+            break;
+    }
+
+    tmns::log::trace( ADD_CURRENT_LOC(), "Mapped raw raster\n", to_log_string( 2 ) );
+    return outcome::ok();
+}
+
+/****************************************/
+/*          Prefetch a Region           */
+/****************************************/
+void Image_Resource_Disk_Raw::prefetch( const math::Rect2i& bbox ) const
+{
+    static const size_t page_size = sysconf( _SC_PAGESIZE );
+
+    // Empty or out-of-bounds regions would put the range outside the mapping
+    if( !m_mapping || bbox.width() <= 0 || bbox.height() <= 0 ||
+        bbox.min().x() < 0 || bbox.min().y() < 0 ||
+        bbox.max().x() > (int)m_format.cols() ||
+        bbox.max().y() > (int)m_format.rows() )
+    {
+        return;
+    }
+
+    // Band-sequential planes are far apart, so advise each plane separately
+    const bool per_plane = ( m_pstride > m_rstride );
+    const size_t ranges  = per_plane ? m_format.planes() : 1;
+    const size_t last_plane = per_plane ? 0 : m_format.planes() - 1;
+    for( size_t p = 0; p < ranges; ++p )
+    {
+        const uint8_t* first = m_data + bbox.min().x() * m_cstride + bbox.min().y() * m_rstride + p * m_pstride;
+        const uint8_t* last  = m_data + ( bbox.max().x() - 1 ) * m_cstride + ( bbox.max().y() - 1 ) * m_rstride
+                                      + ( p + last_plane ) * m_pstride + m_cstride;
+
+        uintptr_t start = reinterpret_cast<uintptr_t>( first ) & ~( page_size - 1 );
+        madvise( reinterpret_cast<void*>( start ),
+                 reinterpret_cast<uintptr_t>( last ) - start,
+                 MADV_WILLNEED );
+    }
+}
+
+/****************************************/
+/*          Get the io_uring Reader     */
+/****************************************/
+std::shared_ptr<Uring_Reader> Image_Resource_Disk_Raw::uring_reader() const
+{
+    std::lock_guard<std::mutex> lock( m_uring_mutex );
+    if( !m_uring )
+    {
+        m_uring = std::shared_ptr<Uring_Reader>();
+        if( m_fd >= 0 )
+        {
+            auto reader = Uring_Reader::create( m_fd );
+            if( reader.has_error() )
+            {
+                tmns::log::debug( ADD_CURRENT_LOC(), "Using mapped reads for ", m_pathname.native(),
+                                  ": ", reader.error().message() );
+            }
+            else
+            {
+                m_uring = reader.value();
+            }
+        }
+    }
+    return m_uring.value();
+}
+
+/****************************************************/
+/*          Read a batch through io_uring           */
+/****************************************************/
+void Image_Resource_Disk_Raw::read_uring( Uring_Reader&                               reader,
+                                          const std::vector<Image_Buffer>&            dests,
+                                          const std::vector<math::Rect2i>&            bboxes,
+                                          std::vector<std::promise<Result<void>>>&    promises ) const
+{
+    const size_t b = channel_size_bytes( m_format.channel_type() ).value();
+
+    // Pixel-interleaved files hold every band of a pixel together, so each row of a region
+    // is one read.  Otherwise each band of each row is one read.
+    const bool   interleaved = ( m_pstride < m_cstride );
+    const size_t bands       = interleaved ? 1 : m_format.planes();
+
+    // Each region is read into a staging buffer, laid out like the file, then converted
+    std::vector<Result<void>>                 results( dests.size(), outcome::ok() );
+    std::vector<std::vector<uint8_t>>         staging( dests.size() );
+    std::vector<std::optional<Image_Buffer>>  staged( dests.size() );
+    std::vector<Uring_Reader::Request>        requests;
+    std::vector<size_t>                       owners;
+
+    for( size_t i = 0; i < dests.size(); ++i )
+    {
+        if( i >= bboxes.size() )
+        {
+            results[i] = outcome::fail( error::Error_Code::INVALID_INPUT,
+                                        "No bounding box for destination ", i,
+                                        ", only ", bboxes.size(), " provided" );
+            continue;
+        }
+        const auto& bbox = bboxes[i];
+        auto check = buffer( bbox );
+        if( check.has_error() )
+        {
+            results[i] = outcome::fail( check.error() );
+            continue;
+        }
+
+        const size_t width     = bbox.width();
+        const size_t height    = bbox.height();
+        const size_t row_bytes = width * m_cstride;
+        const size_t cstride   = interleaved ? m_cstride : b;
+        const size_t rstride   = row_bytes;
+        const size_t pstride   = interleaved ? m_pstride : row_bytes * height;
+        staging[i].resize( row_bytes * height * bands );
+
+        for( size_t p = 0; p < bands;  ++p ) {
+        for( size_t y = 0; y < height; ++y ) {
+            Uring_Reader::Request request;
+            request.offset = m_data_offset
+                           + ( bbox.min().y() + y ) * m_rstride
+                           + bbox.min().x() * m_cstride
+                           + p * m_pstride;
+            request.length = row_bytes;
+            request.dest   = staging[i].data() + p * pstride + y * rstride;
+
+            // Rows which follow each other in the file and in the staging buffer become one read
+            if( !owners.empty() && owners.back() == i )
+            {
+                auto& last = requests.back();
+                if( last.offset + last.length == request.offset &&
+                    last.dest   + last.length == request.dest &&
+                    last.length + request.length <= MAX_MERGED_READ_BYTES )
+                {
+                    last.length += request.length;
+                    continue;
+                }
+            }
+            requests.push_back( request );
+            owners.push_back( i );
+        }}
+
+        auto format = m_format;
+        format.set_cols( width );
+        format.set_rows( height );
+        staged[i].emplace( staging[i].data(), format, cstride, rstride, pstride );
+    }
+
+    reader.read( requests );
+
+    for( size_t r = 0; r < requests.size(); ++r )
+    {
+        auto& result = results[owners[r]];
+        if( requests[r].status != 0 && !result.has_error() )
+        {
+            result = outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                                    "Unable to read ", m_pathname.native(), ": ",
+                                    std::strerror( requests[r].status ) );
+        }
+    }
+
+    for( size_t i = 0; i < dests.size(); ++i )
+    {
+        if( !results[i].has_error() )
+        {
+            results[i] = convert( dests[i], staged[i].value(), m_rescale );
+        }
+        promises[i].set_value( results[i] );
+    }
+}
+
+} // End of tmns::image::io::raw namespace
@@ -0,0 +1,258 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    uring_reader.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include "uring_reader.hpp"
+
+// POSIX Libraries
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// C++ Libraries
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+namespace tmns::image::io::raw {
+
+/****************************************/
+/*          Set up a ring               */
+/****************************************/
+Result<Uring_Reader::ptr_t> Uring_Reader::create( int      fd,
+                                                  unsigned queue_depth )
+{
+    io_uring_params params;
+    std::memset( &params, 0, sizeof( params ) );
+    int ring_fd = (int)::syscall( __NR_io_uring_setup, std::max( queue_depth, 1U ), &params );
+    if( ring_fd < 0 )
+    {
+        return outcome::fail( error::Error_Code::NOT_IMPLEMENTED,
+                              "io_uring is not available: ", std::strerror( errno ) );
+    }
+
+    ptr_t reader( new Uring_Reader() );
+    reader->m_fd      = fd;
+    reader->m_ring_fd = ring_fd;
+
+    // Newer kernels map both rings with a single call
+    reader->m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof( uint32_t );
+    reader->m_cq_ring_size = params.cq_off.cqes  + params.cq_entries * sizeof( io_uring_cqe );
+    const bool single_mmap = ( params.features & IORING_FEAT_SINGLE_MMAP ) != 0;
+    if( single_mmap )
+    {
+        reader->m_sq_ring_size = std::max( reader->m_sq_ring_size, reader->m_cq_ring_size );
+    }
+
+    void* sq_ring = ::mmap( nullptr, reader->m_sq_ring_size, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING );
+    if( sq_ring == MAP_FAILED )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to map io_uring submission ring: ", std::strerror( errno ) );
+    }
+    reader->m_sq_ring = sq_ring;
+
+    if( single_mmap )
+    {
+        reader->m_cq_ring = sq_ring;
+    }
+    else
+    {
+        void* cq_ring = ::mmap( nullptr, reader->m_cq_ring_size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING );
+        if( cq_ring == MAP_FAILED )
+        {
+            return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                                  "Unable to map io_uring completion ring: ", std::strerror( errno ) );
+        }
+        reader->m_cq_ring = cq_ring;
+    }
+
+    reader->m_sqes_size = params.sq_entries * sizeof( io_uring_sqe );
+    void* sqes = ::mmap( nullptr, reader->m_sqes_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES );
+    if( sqes == MAP_FAILED )
+    {
+        return outcome::fail( error::Error_Code::FILE_IO_ERROR,
+                              "Unable to map io_uring submission entries: ", std::strerror( errno ) );
+    }
+    reader->m_sqes = static_cast<io_uring_sqe*>( sqes );
+
+    uint8_t* sq = static_cast<uint8_t*>( reader->m_sq_ring );
+    reader->m_sq_head    = reinterpret_cast<uint32_t*>( sq + params.sq_off.head );
+    reader->m_sq_tail    = reinterpret_cast<uint32_t*>( sq + params.sq_off.tail );
+    reader->m_sq_array   = reinterpret_cast<uint32_t*>( sq + params.sq_off.array );
+    reader->m_sq_mask    = *reinterpret_cast<uint32_t*>( sq + params.sq_off.ring_mask );
+    reader->m_sq_entries = params.sq_entries;
+
+    uint8_t* cq = static_cast<uint8_t*>( reader->m_cq_ring );
+    reader->m_cq_head = reinterpret_cast<uint32_t*>( cq + params.cq_off.head );
+    reader->m_cq_tail = reinterpret_cast<uint32_t*>( cq + params.cq_off.tail );
+    reader->m_cqes    = reinterpret_cast<io_uring_cqe*>( cq + params.cq_off.cqes );
+    reader->m_cq_mask = *reinterpret_cast<uint32_t*>( cq + params.cq_off.ring_mask );
+
+    return outcome::ok<ptr_t>( reader );
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Uring_Reader::~Uring_Reader()
+{
+    if( m_sqes )
+    {
+        ::munmap( m_sqes, m_sqes_size );
+    }
+    if( m_cq_ring && m_cq_ring != m_sq_ring )
+    {
+        ::munmap( m_cq_ring, m_cq_ring_size );
+    }
+    if( m_sq_ring )
+    {
+        ::munmap( m_sq_ring, m_sq_ring_size );
+    }
+    if( m_ring_fd >= 0 )
+    {
+        ::close( m_ring_fd );
+    }
+}
+
+/****************************************/
+/*          Read every request          */
+/****************************************/
+void Uring_Reader::read( std::span<Request> requests )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // Mark every request as outstanding
+    for( auto& request : requests )
+    {
+        request.status = -1;
+    }
+
+    size_t next      = 0;
+    size_t in_flight = 0;
+    while( next < requests.size() || in_flight > 0 )
+    {
+        // Queue as many requests as the ring has room for.  Only this thread moves the tail.
+        uint32_t tail = *m_sq_tail;
+        while( next < requests.size() && in_flight < m_sq_entries )
+        {
+            auto& request = requests[next];
+            if( request.length == 0 )
+            {
+                request.status = 0;
+                ++next;
+                continue;
+            }
+
+            const uint32_t index = tail & m_sq_mask;
+            io_uring_sqe* sqe = &m_sqes[index];
+            std::memset( sqe, 0, sizeof( *sqe ) );
+            sqe->opcode    = IORING_OP_READ;
+            sqe->fd        = m_fd;
+            sqe->off       = request.offset;
+            sqe->addr      = reinterpret_cast<uint64_t>( request.dest );
+            sqe->len       = static_cast<uint32_t>( request.length );
+            sqe->user_data = next;
+            m_sq_array[index] = index;
+
+            ++tail;
+            ++in_flight;
+            ++next;
+        }
+        std::atomic_ref<uint32_t>( *m_sq_tail ).store( tail, std::memory_order_release );
+
+        if( in_flight == 0 )
+        {
+            break;
+        }
+
+        // Submit whatever the kernel has not consumed yet, and wait for a completion
+        const uint32_t pending = tail - std::atomic_ref<uint32_t>( *m_sq_head ).load( std::memory_order_acquire );
+        int ret = (int)::syscall( __NR_io_uring_enter, m_ring_fd, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0 );
+        if( ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY )
+        {
+            // The ring is unusable.  Fail whatever has not completed.
+            const int error = errno;
+            for( auto& request : requests )
+            {
+                if( request.status == -1 )
+                {
+                    request.status = error;
+                }
+            }
+            return;
+        }
+
+        // Reap completions.  Only this thread moves the head.
+        uint32_t head = *m_cq_head;
+        const uint32_t cq_tail = std::atomic_ref<uint32_t>( *m_cq_tail ).load( std::memory_order_acquire );
+        while( head != cq_tail )
+        {
+            const io_uring_cqe& cqe = m_cqes[head & m_cq_mask];
+            auto& request = requests[cqe.user_data];
+            if( cqe.res == -EINVAL || cqe.res == -EOPNOTSUPP || cqe.res == -EAGAIN )
+            {
+                // Kernels before 5.6 have no IORING_OP_READ
+                finish_sync( request, 0 );
+            }
+            else if( cqe.res < 0 )
+            {
+                request.status = -cqe.res;
+            }
+            else if( (size_t)cqe.res < request.length )
+            {
+                finish_sync( request, cqe.res );
+            }
+            else
+            {
+                request.status = 0;
+            }
+            ++head;
+            --in_flight;
+        }
+        std::atomic_ref<uint32_t>( *m_cq_head ).store( head, std::memory_order_release );
+    }
+}
+
+/****************************************************/
+/*          Finish a request with pread()           */
+/****************************************************/
+void Uring_Reader::finish_sync( Request& request,
+                                size_t   done ) const
+{
+    while( done < request.length )
+    {
+        ssize_t count = ::pread( m_fd,
+                                 request.dest + done,
+                                 request.length - done,
+                                 request.offset + done );
+        if( count < 0 && errno == EINTR )
+        {
+            continue;
+        }
+        if( count <= 0 )
+        {
+            request.status = ( count < 0 ) ? errno : EIO;
+            return;
+        }
+        done += count;
+    }
+    request.status = 0;
+}
+
+} // End of tmns::image::io::raw namespace
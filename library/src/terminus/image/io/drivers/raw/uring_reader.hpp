@@ -0,0 +1,137 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    uring_reader.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// External Terminus Libraries
+#include <terminus/error.hpp>
+
+// C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace tmns::image::io::raw {
+
+/**
+ * Batched file reads through a Linux io_uring.
+ *
+ * Talks to the kernel through the raw system calls, so there is no dependency on
+ * liburing.  Every request in a batch is queued before the kernel is entered, so a
+ * single submission keeps up to queue_depth() reads in flight on the device.
+*/
+class Uring_Reader
+{
+    public:
+
+        /// Pointer Type
+        typedef std::shared_ptr<Uring_Reader> ptr_t;
+
+        /**
+         * A single contiguous read
+        */
+        struct Request
+        {
+            /// File offset, in bytes
+            uint64_t offset { 0 };
+
+            /// Number of bytes to read
+            size_t length { 0 };
+
+            /// Where to put the bytes
+            uint8_t* dest { nullptr };
+
+            /// Zero once the read succeeded, otherwise the errno value.  -1 while outstanding.
+            int status { -1 };
+        }; // End of Request struct
+
+        /**
+         * Set up a ring.  Fails if the kernel does not provide io_uring, or it is blocked.
+         *
+         * @param fd File to read.  Must stay open for the life of the reader.
+         * @param queue_depth Number of reads in flight at once
+        */
+        static Result<ptr_t> create( int      fd,
+                                     unsigned queue_depth = 256 );
+
+        Uring_Reader( const Uring_Reader& ) = delete;
+        Uring_Reader& operator = ( const Uring_Reader& ) = delete;
+
+        /**
+         * Unmaps and closes the ring
+        */
+        ~Uring_Reader();
+
+        /**
+         * Read every request, refilling the ring as reads complete.  Sets the status of
+         * each request.  Short reads are finished with pread().  Batches from different
+         * threads take turns on the ring.
+        */
+        void read( std::span<Request> requests );
+
+        /**
+         * Get the number of reads kept in flight
+        */
+        unsigned queue_depth() const { return m_sq_entries; }
+
+    private:
+
+        Uring_Reader() = default;
+
+        /**
+         * Finish a request with pread(), after a short read or an unsupported opcode
+        */
+        void finish_sync( Request& request,
+                          size_t   done ) const;
+
+        /// File being read
+        int m_fd { -1 };
+
+        /// Ring file descriptor
+        int m_ring_fd { -1 };
+
+        /// Mapped rings
+        void*  m_sq_ring { nullptr };
+        void*  m_cq_ring { nullptr };
+        size_t m_sq_ring_size { 0 };
+        size_t m_cq_ring_size { 0 };
+
+        /// Mapped submission entries
+        io_uring_sqe* m_sqes { nullptr };
+        size_t        m_sqes_size { 0 };
+
+        /// Submission ring fields
+        uint32_t* m_sq_head  { nullptr };
+        uint32_t* m_sq_tail  { nullptr };
+        uint32_t* m_sq_array { nullptr };
+        uint32_t  m_sq_mask { 0 };
+        uint32_t  m_sq_entries { 0 };
+
+        /// Completion ring fields
+        uint32_t*     m_cq_head { nullptr };
+        uint32_t*     m_cq_tail { nullptr };
+        io_uring_cqe* m_cqes { nullptr };
+        uint32_t      m_cq_mask { 0 };
+
+        /// One batch uses the ring at a time
+        std::mutex m_mutex;
+
+}; // End of Uring_Reader class
+
+} // End of tmns::image::io::raw namespace
@@ -0,0 +1,225 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    resource_handle_cache.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <terminus/image/io/drivers/resource_handle_cache.hpp>
+
+// Terminus Libraries
+#include <terminus/log/utility.hpp>
+
+// C++ Libraries
+#include <algorithm>
+
+namespace tmns::image::io {
+namespace {
+
+/**
+ * Cache key for a path
+*/
+std::string cache_key( const std::filesystem::path& pathname )
+{
+    return std::filesystem::absolute( pathname ).lexically_normal().string();
+}
+
+/**
+ * Current modification time and size of a file
+*/
+bool file_stamp( const std::filesystem::path&     pathname,
+                 std::filesystem::file_time_type& mtime,
+                 uintmax_t&                       file_size )
+{
+    std::error_code ec;
+    mtime = std::filesystem::last_write_time( pathname, ec );
+    if( ec )
+    {
+        return false;
+    }
+    file_size = std::filesystem::file_size( pathname, ec );
+    return !ec;
+}
+
+} // End of anonymous namespace
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Resource_Handle_Cache::Resource_Handle_Cache( size_t max_open )
+  : m_max_open( max_open )
+{
+}
+
+/****************************************/
+/*          Get the shared cache        */
+/****************************************/
+Resource_Handle_Cache::ptr_t Resource_Handle_Cache::instance()
+{
+    static ptr_t cache = std::make_shared<Resource_Handle_Cache>();
+    return cache;
+}
+
+/********************************************/
+/*          Default open-file budget        */
+/********************************************/
+size_t Resource_Handle_Cache::default_max_open()
+{
+    return 256;
+}
+
+/****************************************/
+/*          Find a cached resource      */
+/****************************************/
+Resource_Handle_Cache::DriverT Resource_Handle_Cache::find( const std::filesystem::path&    pathname,
+                                                            const std::vector<std::string>& driver_keys )
+{
+    const auto key = cache_key( pathname );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    auto it = m_index.find( key );
+    if( it == m_index.end() )
+    {
+        return nullptr;
+    }
+
+    std::filesystem::file_time_type mtime;
+    uintmax_t file_size;
+    if( !file_stamp( pathname, mtime, file_size ) ||
+        mtime != it->second->mtime ||
+        file_size != it->second->file_size )
+    {
+        tmns::log::trace( ADD_CURRENT_LOC(), "Dropping stale handle for ", key );
+        m_entries.erase( it->second );
+        m_index.erase( it );
+        return nullptr;
+    }
+
+    if( std::find( driver_keys.begin(),
+                   driver_keys.end(),
+                   it->second->driver_key ) == driver_keys.end() )
+    {
+        return nullptr;
+    }
+
+    // Mark as most-recently-used
+    m_entries.splice( m_entries.begin(), m_entries, it->second );
+    return it->second->resource;
+}
+
+/****************************************/
+/*          Add an open resource        */
+/****************************************/
+Resource_Handle_Cache::DriverT Resource_Handle_Cache::insert( const std::filesystem::path& pathname,
+                                                              const std::string&           driver_key,
+                                                              DriverT                      resource )
+{
+    if( !resource )
+    {
+        return resource;
+    }
+
+    Entry entry { cache_key( pathname ), driver_key, {}, 0, resource };
+    if( !file_stamp( pathname, entry.mtime, entry.file_size ) )
+    {
+        return resource;
+    }
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    if( m_max_open == 0 )
+    {
+        return resource;
+    }
+
+    auto it = m_index.find( entry.key );
+    if( it != m_index.end() )
+    {
+        if( it->second->mtime == entry.mtime &&
+            it->second->file_size == entry.file_size &&
+            it->second->driver_key == driver_key )
+        {
+            m_entries.splice( m_entries.begin(), m_entries, it->second );
+            return it->second->resource;
+        }
+        m_entries.erase( it->second );
+        m_index.erase( it );
+    }
+
+    m_entries.push_front( std::move( entry ) );
+    m_index[m_entries.front().key] = m_entries.begin();
+    evict();
+    return resource;
+}
+
+/****************************************/
+/*          Drop a cached resource      */
+/****************************************/
+void Resource_Handle_Cache::erase( const std::filesystem::path& pathname )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    auto it = m_index.find( cache_key( pathname ) );
+    if( it != m_index.end() )
+    {
+        m_entries.erase( it->second );
+        m_index.erase( it );
+    }
+}
+
+/********************************************/
+/*          Drop all cached resources       */
+/********************************************/
+void Resource_Handle_Cache::clear()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_index.clear();
+    m_entries.clear();
+}
+
+/****************************************************/
+/*          Get the number of cached resources      */
+/****************************************************/
+size_t Resource_Handle_Cache::size() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_entries.size();
+}
+
+/********************************************/
+/*          Get the open-file budget        */
+/********************************************/
+size_t Resource_Handle_Cache::max_open() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_max_open;
+}
+
+/********************************************/
+/*          Set the open-file budget        */
+/********************************************/
+void Resource_Handle_Cache::set_max_open( size_t max_open )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    m_max_open = max_open;
+    evict();
+}
+
+/****************************************************/
+/*          Drop entries over the budget            */
+/****************************************************/
+void Resource_Handle_Cache::evict()
+{
+    while( m_entries.size() > m_max_open )
+    {
+        m_index.erase( m_entries.back().key );
+        m_entries.pop_back();
+    }
+}
+
+} // End of tmns::image::io namespace
@@ -44,6 +44,14 @@ void Image_Resource_Disk::set_rescale( bool rescale )
     m_rescale = rescale;
 }
 
+/********************************************/
+/*    Fill with the empty-region value      */
+/********************************************/
+Result<void> Image_Resource_Disk::read_fill( const Image_Buffer& dest ) const
+{
+    return convert_fill( dest, m_rescale );
+}
+
 /****************************************/
 /*    Set the default rescale factor    */
 /****************************************/
@@ -15,8 +15,13 @@
 #include <terminus/image/pixel/convert.hpp>
 
 // C++ Libraries
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 // Boost Libraries
 #include <boost/integer_traits.hpp>
@@ -427,6 +432,124 @@ Channel_Unpremultiply_Map_Entry _unpremultiply_f32( &channel_unpremultiply_float
 Channel_Unpremultiply_Map_Entry _unpremultiply_f64( &channel_unpremultiply_float<double> );
 
 
+//------------------------------------------------------------------------------------
+// Section for building validity channels
+
+/// Check if num_channels() knows the pixel format
+bool has_channel_count( Pixel_Format_Enum value )
+{
+    switch( value )
+    {
+        case Pixel_Format_Enum::SCALAR:
+        case Pixel_Format_Enum::GRAY:
+        case Pixel_Format_Enum::GRAYA:
+        case Pixel_Format_Enum::RGB:
+        case Pixel_Format_Enum::RGBA:
+        case Pixel_Format_Enum::SCALAR_MASKED:
+        case Pixel_Format_Enum::GRAY_MASKED:
+        case Pixel_Format_Enum::GRAYA_MASKED:
+        case Pixel_Format_Enum::RGB_MASKED:
+        case Pixel_Format_Enum::RGBA_MASKED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Flag the pixels in a row holding data, i.e. not every channel equals nodata.
+ *
+ * Kept separate from the write so the compare runs over a single known type,
+ * which the compiler can vectorize.  Channels are @p chstride bytes apart.
+*/
+template <typename T>
+void flag_valid_row( const uint8_t*  src,
+                     size_t          cstride,
+                     size_t          chstride,
+                     size_t          channels,
+                     size_t          cols,
+                     double          nodata,
+                     uint8_t*        flags )
+{
+    if constexpr( std::is_integral_v<T> )
+    {
+        // Nodata values the type can't hold never match
+        if( std::isnan( nodata ) ||
+            nodata < static_cast<double>( std::numeric_limits<T>::lowest() ) ||
+            nodata > static_cast<double>( std::numeric_limits<T>::max() ) )
+        {
+            std::memset( flags, 1, cols );
+            return;
+        }
+    }
+    const T    value  = static_cast<T>( nodata );
+    const bool is_nan = std::isnan( nodata );
+
+    for( size_t c = 0; c < cols; ++c )
+    {
+        uint8_t valid = 0;
+        for( size_t ch = 0; ch < channels; ++ch )
+        {
+            T pix;
+            std::memcpy( &pix, src + c * cstride + ch * chstride, sizeof( T ) );
+            if constexpr( std::is_floating_point_v<T> )
+            {
+                valid |= is_nan ? !std::isnan( pix ) : ( pix != value );
+            }
+            else
+            {
+                valid |= ( pix != value );
+            }
+        }
+        flags[c] = valid;
+    }
+}
+
+/**
+ * Write the validity channel for a row from the flags
+*/
+template <typename T>
+void write_valid_row( const uint8_t*  flags,
+                      size_t          cols,
+                      uint8_t*        dst,
+                      size_t          cstride,
+                      const void*     valid_value )
+{
+    T valid;
+    std::memcpy( &valid, valid_value, sizeof( T ) );
+    const T invalid = T();
+
+    for( size_t c = 0; c < cols; ++c )
+    {
+        const T value = flags[c] ? valid : invalid;
+        std::memcpy( dst + c * cstride, &value, sizeof( T ) );
+    }
+}
+
+/**
+ * Call a generic function with a value of the C++ type behind the channel type.
+ * Returns false for channel types without one.
+*/
+template <typename FuncT>
+bool dispatch_channel_type( Channel_Type_Enum type, FuncT&& func )
+{
+    switch( type )
+    {
+        case Channel_Type_Enum::UINT8:   func( uint8_t()  ); return true;
+        case Channel_Type_Enum::UINT16:  func( uint16_t() ); return true;
+        case Channel_Type_Enum::UINT32:  func( uint32_t() ); return true;
+        case Channel_Type_Enum::UINT64:  func( uint64_t() ); return true;
+        case Channel_Type_Enum::INT8:    func( int8_t()   ); return true;
+        case Channel_Type_Enum::INT16:   func( int16_t()  ); return true;
+        case Channel_Type_Enum::INT32:   func( int32_t()  ); return true;
+        case Channel_Type_Enum::INT64:   func( int64_t()  ); return true;
+        case Channel_Type_Enum::FLOAT32: func( float()    ); return true;
+        case Channel_Type_Enum::FLOAT64: func( double()   ); return true;
+        default:
+            return false;
+    }
+}
+
 /****************************************/
 /*          Convert Pixel Data          */
 /****************************************/
@@ -442,6 +565,17 @@ Result<void> convert( const Image_Buffer&  dst,
                               "Destination buffer has incorrect size." );
     }
 
+    // Unmasked data into a masked type.  There is no nodata value here, so every
+    // pixel is valid.  Alpha channels standing in for the mask are handled below.
+    if( is_masked( dst.format().pixel_type() )  &&
+        !is_masked( src.format().pixel_type() ) &&
+        has_channel_count( src.format().pixel_type() ) &&
+        has_channel_count( dst.format().pixel_type() ) &&
+        num_channels( src.format().pixel_type() ).value() != num_channels( dst.format().pixel_type() ).value() )
+    {
+        return convert_masked( dst, src, std::nullopt, rescale );
+    }
+
     // If pixel types are the same, then it's a channel conversion
     if( dst.format().pixel_type() != src.format().pixel_type() )
     {
@@ -687,4 +821,96 @@ Result<void> convert( const Image_Buffer&  dst,
     return outcome::ok();
 } // End function convert
 
-} // End of tmns::image namespace
\ No newline at end of file
+/************************************************/
+/*          Convert to a Masked Pixel Type      */
+/************************************************/
+Result<void> convert_masked( const Image_Buffer&    dst,
+                             const Image_Buffer&    src,
+                             std::optional<double>  nodata,
+                             bool                   rescale )
+{
+    if( !is_masked( dst.format().pixel_type() ) )
+    {
+        return convert( dst, src, rescale );
+    }
+    if( is_masked( src.format().pixel_type() ) ||
+        !has_channel_count( src.format().pixel_type() ) ||
+        !has_channel_count( dst.format().pixel_type() ) )
+    {
+        return outcome::fail( error::Error_Code::INVALID_PIXEL_TYPE,
+                              "Unsupported masked conversion. Source: ",
+                              enum_to_string( src.format().pixel_type() ), ", Destination: ",
+                              enum_to_string( dst.format().pixel_type() ) );
+    }
+
+    // Convert the data channels by viewing the destination as its unmasked format.
+    // The pixel stride is unchanged, so the validity channels are skipped over.
+    Image_Buffer dst_data = dst;
+    dst_data.format().set_pixel_type( to_unmasked( dst.format().pixel_type() ) );
+    auto result = convert( dst_data, src, rescale );
+    if( result.has_error() )
+    {
+        return result;
+    }
+
+    const size_t dst_chsize   = channel_size_bytes( dst.format().channel_type() ).value();
+    const size_t src_chsize   = channel_size_bytes( src.format().channel_type() ).value();
+    const size_t valid_offset = num_channels( dst_data.format().pixel_type() ).value() * dst_chsize;
+
+    // Multi-plane scalar sources were aliased as channels by convert()
+    const bool   src_planar   = src.format().planes() != dst.format().planes();
+    const size_t src_channels = src_planar ? src.format().planes()
+                                           : num_channels( src.format().pixel_type() ).value();
+    const size_t src_chstride = src_planar ? static_cast<size_t>( src.pstride() ) : src_chsize;
+
+    // Validity value for the destination channel type
+    channel_set_max_func max_func = channel_set_max_map->operator[]( dst.format().channel_type() );
+    if( !max_func )
+    {
+        return outcome::fail( error::Error_Code::INVALID_CHANNEL_TYPE,
+                              "Unsupported channel-type for the validity channel ( ",
+                              dst.format().channel_type(), " )" );
+    }
+    uint64_t valid_value[2] {};
+    max_func( valid_value );
+
+    const size_t cols = dst.format().cols();
+    std::vector<uint8_t> flags( cols, 1 );
+
+    for( size_t p = 0; p < dst.format().planes(); ++p ) {
+    for( size_t r = 0; r < dst.format().rows();   ++r )
+    {
+        if( nodata )
+        {
+            const uint8_t* src_row = (const uint8_t*) src( 0, static_cast<int>(r), src_planar ? 0 : static_cast<int>(p) );
+            bool ok = dispatch_channel_type( src.format().channel_type(), [&]( auto tag ) {
+                flag_valid_row<decltype(tag)>( src_row,
+                                               src.cstride(),
+                                               src_chstride,
+                                               src_channels,
+                                               cols,
+                                               nodata.value(),
+                                               flags.data() );
+            });
+            if( !ok )
+            {
+                return outcome::fail( error::Error_Code::INVALID_CHANNEL_TYPE,
+                                      "Unsupported channel-type for nodata masking ( ",
+                                      src.format().channel_type(), " )" );
+            }
+        }
+
+        uint8_t* dst_row = (uint8_t*) dst( 0, static_cast<int>(r), static_cast<int>(p) ) + valid_offset;
+        dispatch_channel_type( dst.format().channel_type(), [&]( auto tag ) {
+            write_valid_row<decltype(tag)>( flags.data(),
+                                            cols,
+                                            dst_row,
+                                            dst.cstride(),
+                                            valid_value );
+        });
+    }}
+
+    return outcome::ok();
+} // End function convert_masked
+
+} // End of tmns::image namespace
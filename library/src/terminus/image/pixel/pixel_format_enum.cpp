@@ -42,6 +42,16 @@ std::string enum_to_string( Pixel_Format_Enum val )
             return "GENERIC_4_CHANNEL";
         case Pixel_Format_Enum::UNKNOWN:
             return "UNKNOWN";
+        case Pixel_Format_Enum::SCALAR_MASKED:
+            return "SCALAR_MASKED";
+        case Pixel_Format_Enum::GRAY_MASKED:
+            return "GRAY_MASKED";
+        case Pixel_Format_Enum::GRAYA_MASKED:
+            return "GRAYA_MASKED";
+        case Pixel_Format_Enum::RGB_MASKED:
+            return "RGB_MASKED";
+        case Pixel_Format_Enum::RGBA_MASKED:
+            return "RGBA_MASKED";
         default:
 
             throw std::runtime_error( "Don't be lazy!" );
@@ -70,6 +80,20 @@ Result<int> num_channels( Pixel_Format_Enum value )
         case Pixel_Format_Enum::GENERIC_4_CHANNEL:
             return outcome::ok<int>( 3 );
 
+        // Masked formats add the validity channel after the data channels
+        case Pixel_Format_Enum::GRAY_MASKED:
+        case Pixel_Format_Enum::SCALAR_MASKED:
+            return outcome::ok<int>( 2 );
+
+        case Pixel_Format_Enum::GRAYA_MASKED:
+            return outcome::ok<int>( 3 );
+
+        case Pixel_Format_Enum::RGB_MASKED:
+            return outcome::ok<int>( 4 );
+
+        case Pixel_Format_Enum::RGBA_MASKED:
+            return outcome::ok<int>( 5 );
+
         case Pixel_Format_Enum::UNKNOWN:
             return outcome::fail( error::Error_Code::INVALID_PIXEL_TYPE );
 
@@ -0,0 +1,120 @@
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/*                                                                                    */
+/*                           Copyright (c) 2025 Terminus LLC                          */
+/*                                                                                    */
+/*                                All Rights Reserved.                                */
+/*                                                                                    */
+/*          Use of this source code is governed by LICENSE in the repo root.          */
+/*                                                                                    */
+/**************************** INTELLECTUAL PROPERTY RIGHTS ****************************/
+/**
+ * @file    async_read_queue.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <terminus/image/types/async_read_queue.hpp>
+
+// Terminus Libraries
+#include <terminus/core/work/Thread.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <thread>
+
+namespace tmns::image {
+
+/********************************/
+/*          Constructor         */
+/********************************/
+Async_Read_Queue::Async_Read_Queue( size_t num_threads )
+{
+    for( size_t i = 0; i < std::max<size_t>( num_threads, 1 ); ++i )
+    {
+        m_threads.push_back( std::make_shared<core::work::Thread>( std::make_shared<Worker>( *this ) ) );
+    }
+}
+
+/********************************/
+/*          Destructor          */
+/********************************/
+Async_Read_Queue::~Async_Read_Queue()
+{
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    for( auto& thread : m_threads )
+    {
+        thread->join();
+    }
+}
+
+/****************************************/
+/*          Get the shared queue        */
+/****************************************/
+Async_Read_Queue& Async_Read_Queue::instance()
+{
+    static Async_Read_Queue queue( default_num_threads() );
+    return queue;
+}
+
+/************************************************/
+/*          Default number of I/O threads       */
+/************************************************/
+size_t Async_Read_Queue::default_num_threads()
+{
+    return std::max<size_t>( 2 * std::thread::hardware_concurrency(), 8 );
+}
+
+/****************************************/
+/*          Queue a batch of reads      */
+/****************************************/
+std::vector<std::future<Result<void>>> Async_Read_Queue::submit( std::vector<job_type> jobs )
+{
+    std::vector<std::future<Result<void>>> futures;
+    futures.reserve( jobs.size() );
+    {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        for( auto& job : jobs )
+        {
+            futures.push_back( job.get_future() );
+            m_jobs.push_back( std::move( job ) );
+        }
+    }
+    m_cond.notify_all();
+    return futures;
+}
+
+/********************************************/
+/*          Get the number of queued reads  */
+/********************************************/
+size_t Async_Read_Queue::pending() const
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+    return m_jobs.size();
+}
+
+/********************************/
+/*          Worker loop         */
+/********************************/
+void Async_Read_Queue::Worker::operator()()
+{
+    while( true )
+    {
+        job_type job;
+        {
+            std::unique_lock<std::mutex> lock( m_queue.m_mutex );
+            m_queue.m_cond.wait( lock, [this]{ return m_queue.m_stop || !m_queue.m_jobs.empty(); } );
+            if( m_queue.m_jobs.empty() )
+            {
+                return;
+            }
+            job = std::move( m_queue.m_jobs.front() );
+            m_queue.m_jobs.pop_front();
+        }
+        job();
+    }
+}
+
+} // End of tmns::image namespace
@@ -151,6 +151,29 @@ void Image_Buffer::set_pstride( ssize_t value )
     m_pstride = value;
 }
 
+/****************************************/
+/*          Crop to Sub-Region          */
+/****************************************/
+Image_Buffer Image_Buffer::cropped( const math::Rect2i& bbox ) const
+{
+    Image_Buffer result = *this;
+    result.m_data = operator()( bbox.min().x(), bbox.min().y(), 0 );
+    result.m_format.set_cols( bbox.width() );
+    result.m_format.set_rows( bbox.height() );
+    return result;
+}
+
+/********************************/
+/*          Select Plane        */
+/********************************/
+Image_Buffer Image_Buffer::plane( int plane ) const
+{
+    Image_Buffer result = *this;
+    result.m_data = operator()( 0, 0, plane );
+    result.m_format.set_planes( 1 );
+    return result;
+}
+
 /************************************/
 /*      Access Pointer at Pixel     */
 /************************************/
@@ -16,8 +16,149 @@
 
 // Terminus Image Libraries
 #include <terminus/image/pixel/channel_type_enum.hpp>
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/types/async_read_queue.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <optional>
 
 namespace tmns::image {
+namespace {
+
+/// Largest merged read, in pixels
+const int64_t MAX_COALESCED_PIXELS = 4096 * 4096;
+
+/// Fraction of extra pixels a merged read may cost over separate reads
+const double COALESCE_SLACK = 1.25;
+
+/**
+ * Regions read together, and the destinations they feed
+*/
+struct Read_Group
+{
+    math::Rect2i        region;
+    std::vector<size_t> members;
+}; // End of Read_Group struct
+
+/**
+ * Smallest rectangle containing both inputs
+*/
+math::Rect2i bbox_union( const math::Rect2i& a,
+                         const math::Rect2i& b )
+{
+    const int x0 = std::min( a.min().x(), b.min().x() );
+    const int y0 = std::min( a.min().y(), b.min().y() );
+    const int x1 = std::max( a.max().x(), b.max().x() );
+    const int y1 = std::max( a.max().y(), b.max().y() );
+    return math::Rect2i( x0, y0, x1 - x0, y1 - y0 );
+}
+
+/**
+ * Grow a region out to block boundaries, clipped to the image
+*/
+math::Rect2i align_to_blocks( const math::Rect2i& bbox,
+                              const math::Size2i& block_size,
+                              const math::Rect2i& image_bbox )
+{
+    const int bw = std::max( block_size.width(),  1 );
+    const int bh = std::max( block_size.height(), 1 );
+    const int x0 = ( bbox.min().x() / bw ) * bw;
+    const int y0 = ( bbox.min().y() / bh ) * bh;
+    const int x1 = std::min( ( ( bbox.max().x() + bw - 1 ) / bw ) * bw, image_bbox.max().x() );
+    const int y1 = std::min( ( ( bbox.max().y() + bh - 1 ) / bh ) * bh, image_bbox.max().y() );
+    return math::Rect2i( x0, y0, x1 - x0, y1 - y0 );
+}
+
+/**
+ * Check if two destinations can share one intermediate buffer
+*/
+bool same_layout( const Image_Format& a,
+                  const Image_Format& b )
+{
+    return a.pixel_type()   == b.pixel_type()   &&
+           a.channel_type() == b.channel_type() &&
+           a.planes()       == b.planes()       &&
+           a.premultiply()  == b.premultiply();
+}
+
+/**
+ * Group reads so that a merged read costs at most COALESCE_SLACK times the blocks
+ * of reading the pieces separately.
+ * Out-of-bounds regions stay on their own so the resource reports them.
+*/
+std::vector<Read_Group> coalesce_reads( std::span<const math::Rect2i> bboxes,
+                                        std::span<const Image_Buffer> dests,
+                                        const math::Size2i&           block_size,
+                                        const math::Rect2i&           image_bbox )
+{
+    std::vector<size_t> order( bboxes.size() );
+    std::iota( order.begin(), order.end(), 0 );
+    std::sort( order.begin(), order.end(), [&]( size_t a, size_t b ) {
+        return std::make_pair( bboxes[a].min().y(), bboxes[a].min().x() ) <
+               std::make_pair( bboxes[b].min().y(), bboxes[b].min().x() ); } );
+
+    auto cost = [&]( const math::Rect2i& bbox ) {
+        return (int64_t)align_to_blocks( bbox, block_size, image_bbox ).area(); };
+
+    std::vector<Read_Group> groups;
+    for( auto index : order )
+    {
+        const auto& bbox = bboxes[index];
+        const bool inside = bbox.width() > 0 && bbox.height() > 0 &&
+                            bbox.min().x() >= 0 && bbox.min().y() >= 0 &&
+                            bbox.max().x() <= image_bbox.max().x() &&
+                            bbox.max().y() <= image_bbox.max().y();
+
+        bool merged = false;
+        for( auto& group : groups )
+        {
+            if( !inside || group.region.area() == 0 ||
+                !same_layout( dests[group.members.front()].format(), dests[index].format() ) )
+            {
+                continue;
+            }
+            auto candidate = bbox_union( group.region, bbox );
+            if( cost( candidate ) <= COALESCE_SLACK * ( cost( group.region ) + cost( bbox ) ) &&
+                cost( candidate ) <= MAX_COALESCED_PIXELS )
+            {
+                group.region = candidate;
+                group.members.push_back( index );
+                merged = true;
+                break;
+            }
+        }
+        if( !merged )
+        {
+            groups.push_back( Read_Group{ inside ? bbox : math::Rect2i( 0, 0, 0, 0 ), { index } } );
+        }
+    }
+    return groups;
+}
+
+} // End of anonymous namespace
+
+/**
+ * Asynchronous reads of a single resource.  At most one I/O thread drains the queue
+ * at a time, so reads never overlap and other resources keep the remaining threads.
+*/
+struct Read_Image_Resource_Base::Read_Strand
+{
+    std::mutex                                   mutex;
+    std::deque<Async_Read_Queue::job_type>       jobs;
+    bool                                         draining { false };
+}; // End of Read_Strand struct
+
+/****************************************/
+/*          Constructor                 */
+/****************************************/
+Read_Image_Resource_Base::Read_Image_Resource_Base()
+  : m_read_strand( std::make_shared<Read_Strand>() )
+{
+}
 
 /****************************************************/
 /*          Get the number of image columns         */
@@ -75,6 +216,156 @@ Channel_Type_Enum Read_Image_Resource_Base::channel_type() const
     return format().channel_type();
 }
 
+/************************************************/
+/*          Read the image asynchronously       */
+/************************************************/
+std::future<Result<void>> Read_Image_Resource_Base::read_async( const Image_Buffer& dest,
+                                                                const math::Rect2i& bbox ) const
+{
+    auto futures = read_async( std::vector<Image_Buffer>( { dest } ),
+                               std::vector<math::Rect2i>( { bbox } ) );
+    return std::move( futures.front() );
+}
+
+/************************************************/
+/*          Queue a batch of reads              */
+/************************************************/
+std::vector<std::future<Result<void>>>
+        Read_Image_Resource_Base::read_async( const std::vector<Image_Buffer>& dests,
+                                              const std::vector<math::Rect2i>& bboxes ) const
+{
+    // Keep the resource alive while reads are pending if it is shared, or rely on the
+    // caller otherwise.  The aliased pointer shares ownership only in the first case.
+    std::shared_ptr<const Read_Image_Resource_Base> self( weak_from_this().lock(), this );
+
+    std::vector<Async_Read_Queue::job_type> jobs;
+    jobs.reserve( dests.size() );
+    for( size_t i = 0; i < dests.size(); ++i )
+    {
+        if( i >= bboxes.size() )
+        {
+            jobs.emplace_back( [count = bboxes.size(), i]() -> Result<void> {
+                return outcome::fail( error::Error_Code::INVALID_INPUT,
+                                      "No bounding box for destination ", i,
+                                      ", only ", count, " provided" ); } );
+            continue;
+        }
+        jobs.emplace_back( [self, dest = dests[i], bbox = bboxes[i]]() {
+            return self->read( dest, bbox ); } );
+    }
+
+    // Resources safe to read from several threads skip the strand
+    if( has_concurrent_read() )
+    {
+        return Async_Read_Queue::instance().submit( std::move( jobs ) );
+    }
+
+    // Queue the reads on the strand, starting a drain job if none is running
+    std::vector<std::future<Result<void>>> futures;
+    futures.reserve( jobs.size() );
+    bool start_drain = false;
+    {
+        std::lock_guard<std::mutex> lock( m_read_strand->mutex );
+        for( auto& job : jobs )
+        {
+            futures.push_back( job.get_future() );
+            m_read_strand->jobs.push_back( std::move( job ) );
+        }
+        start_drain = !m_read_strand->draining && !m_read_strand->jobs.empty();
+        m_read_strand->draining = m_read_strand->draining || start_drain;
+    }
+
+    if( start_drain )
+    {
+        std::vector<Async_Read_Queue::job_type> drain;
+        drain.emplace_back( [strand = m_read_strand]() -> Result<void> {
+            while( true )
+            {
+                Async_Read_Queue::job_type job;
+                {
+                    std::lock_guard<std::mutex> lock( strand->mutex );
+                    if( strand->jobs.empty() )
+                    {
+                        strand->draining = false;
+                        return outcome::ok();
+                    }
+                    job = std::move( strand->jobs.front() );
+                    strand->jobs.pop_front();
+                }
+                job();
+            }
+        });
+        Async_Read_Queue::instance().submit( std::move( drain ) );
+    }
+    return futures;
+}
+
+/****************************************/
+/*          Prefetch a region           */
+/****************************************/
+void Read_Image_Resource_Base::prefetch( [[maybe_unused]] const math::Rect2i& bbox ) const
+{
+}
+
+/****************************************/
+/*          Read many regions           */
+/****************************************/
+Result<void> Read_Image_Resource_Base::read_many( std::span<const math::Rect2i> bboxes,
+                                                  std::span<const Image_Buffer> dests ) const
+{
+    if( bboxes.size() != dests.size() )
+    {
+        return outcome::fail( error::Error_Code::INVALID_INPUT,
+                              "Got ", bboxes.size(), " regions for ", dests.size(), " destinations" );
+    }
+
+    const auto block_size = has_block_read() ? block_read_size() : math::Size2i( { 1, 1 } );
+    const auto image_bbox = full_bbox();
+    for( const auto& group : coalesce_reads( bboxes, dests, block_size, image_bbox ) )
+    {
+        if( group.members.size() == 1 )
+        {
+            auto index = group.members.front();
+            auto res = read( dests[index], bboxes[index] );
+            if( res.has_error() )
+            {
+                return res;
+            }
+            continue;
+        }
+
+        // Read the merged region once, in the destinations' format, then scatter it
+        auto region = align_to_blocks( group.region, block_size, image_bbox );
+        auto merged_format = dests[group.members.front()].format();
+        merged_format.set_cols( region.width() );
+        merged_format.set_rows( region.height() );
+
+        std::vector<uint8_t> scratch( merged_format.raster_size_bytes() );
+        Image_Buffer merged( merged_format, scratch.data() );
+        auto res = read( merged, region );
+        if( res.has_error() )
+        {
+            return res;
+        }
+
+        for( auto index : group.members )
+        {
+            const auto& bbox = bboxes[index];
+            res = convert( dests[index],
+                           merged.cropped( math::Rect2i( bbox.min().x() - region.min().x(),
+                                                         bbox.min().y() - region.min().y(),
+                                                         bbox.width(),
+                                                         bbox.height() ) ),
+                           false );
+            if( res.has_error() )
+            {
+                return res;
+            }
+        }
+    }
+    return outcome::ok();
+}
+
 /********************************************/
 /*          Get the block read size         */
 /********************************************/
@@ -92,6 +383,103 @@ double Read_Image_Resource_Base::nodata_read() const
     throw std::runtime_error( "Unsupported feature" );
 }
 
+/****************************************/
+/*          Read a single block         */
+/****************************************/
+Result<void> Read_Image_Resource_Base::read_block( int                 ix,
+                                                   int                 iy,
+                                                   const Image_Buffer& dest ) const
+{
+    if( !has_block_read() )
+    {
+        return outcome::fail( error::Error_Code::NOT_IMPLEMENTED,
+                              "This resource does not support block reads." );
+    }
+
+    const auto block_size = block_read_size();
+    auto bbox = math::Rect2i::intersection( math::Rect2i( ix * block_size.width(),
+                                                          iy * block_size.height(),
+                                                          block_size.width(),
+                                                          block_size.height() ),
+                                            full_bbox() );
+    if( ix < 0 || iy < 0 || bbox.width() <= 0 || bbox.height() <= 0 )
+    {
+        return outcome::fail( error::Error_Code::OUT_OF_BOUNDS,
+                              "Block (", ix, ", ", iy, ") is outside the image. ",
+                              full_bbox().to_string() );
+    }
+    return read( dest, bbox );
+}
+
+/************************************************/
+/*      Check if concurrent reads are safe      */
+/************************************************/
+bool Read_Image_Resource_Base::has_concurrent_read() const
+{
+    return false;
+}
+
+/************************************************/
+/*          Check if a region is empty          */
+/************************************************/
+bool Read_Image_Resource_Base::is_empty( [[maybe_unused]] const math::Rect2i& bbox ) const
+{
+    return false;
+}
+
+/****************************************************/
+/*          Check if empty regions are reported     */
+/****************************************************/
+bool Read_Image_Resource_Base::has_empty_regions() const
+{
+    return false;
+}
+
+/************************************************/
+/*          Read the empty-region value         */
+/************************************************/
+Result<void> Read_Image_Resource_Base::read_fill( const Image_Buffer& dest ) const
+{
+    return convert_fill( dest, false );
+}
+
+/****************************************************/
+/*          Convert the empty-region value          */
+/****************************************************/
+Result<void> Read_Image_Resource_Base::convert_fill( const Image_Buffer& dest,
+                                                     bool                rescale ) const
+{
+    std::optional<double> nodata;
+    if( has_nodata_read() )
+    {
+        nodata = nodata_read();
+    }
+
+    // Native data as the driver would produce it, from a double-precision copy
+    Image_Format native_format = format();
+    native_format.set_cols( dest.format().cols() );
+    native_format.set_rows( dest.format().rows() );
+    std::vector<uint8_t> native_data( native_format.raster_size_bytes() );
+    Image_Buffer native( native_format, native_data.data() );
+
+    Image_Format value_format = native_format;
+    value_format.set_channel_type( Channel_Type_Enum::FLOAT64 );
+    std::vector<double> values( value_format.raster_size_bytes() / sizeof( double ),
+                                nodata.value_or( 0 ) );
+    auto result = convert( native, Image_Buffer( value_format, values.data() ), false );
+    if( result.has_error() )
+    {
+        return result;
+    }
+
+    // Masked destinations mark nodata pixels invalid, as reads do
+    if( is_masked( dest.format().pixel_type() ) )
+    {
+        return convert_masked( dest, native, nodata, rescale );
+    }
+    return convert( dest, native, rescale );
+}
+
 /********************************************/
 /*          Get the native pointer          */
 /********************************************/
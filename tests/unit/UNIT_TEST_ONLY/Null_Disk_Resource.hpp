@@ -0,0 +1,35 @@
+/**
+ * @file    Null_Disk_Resource.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/image/io/image_resource_disk.hpp>
+
+namespace tmns::image::io {
+
+/**
+ * Resource which does nothing but remember its path
+*/
+class Null_Disk_Resource : public Image_Resource_Disk
+{
+    public:
+
+        Null_Disk_Resource( const std::filesystem::path& pathname ) : Image_Resource_Disk( pathname ) {}
+
+        std::string resource_name() const override { return "Null"; }
+        std::string to_log_string( size_t offset ) const override { return ""; }
+        Image_Format format() const override { return Image_Format(); }
+        Result<void> read( const Image_Buffer&, const math::Rect2i& ) const override { return outcome::ok(); }
+        bool has_block_read() const override { return false; }
+        bool has_nodata_read() const override { return false; }
+        Result<void> write( const Image_Buffer&, const math::Rect2i& ) override { return outcome::ok(); }
+        bool has_block_write() const override { return false; }
+        bool has_nodata_write() const override { return false; }
+        void flush() override {}
+
+}; // End of Null_Disk_Resource class
+
+} // End of tmns::image::io namespace
@@ -134,6 +134,12 @@ class Prerasterization_Test_View : public tx::Image_Base<Prerasterization_Test_V
             return "Prerasterization_Test_View";
         }
 
+        /// Underlying pixels
+        const tx::Image_Memory<uint8_t>& image() const
+        {
+            return m_image;
+        }
+
     private:
 
         // Underlying image
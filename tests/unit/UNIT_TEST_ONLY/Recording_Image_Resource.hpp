@@ -0,0 +1,133 @@
+/**
+ * @file    Recording_Image_Resource.hpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#pragma once
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/pixel/convert.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_resource_base.hpp>
+#include <terminus/math/Rectangle.hpp>
+
+// C++ Libraries
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/**
+ * In-memory resource which records every region passed to read() and every
+ * block handed to write(), and copies written data into a backing image.
+ * Regions passed to mark_empty() are reported by is_empty().  A nodata value
+ * may be set with set_nodata_read().
+*/
+template <typename PixelT>
+class Recording_Image_Resource : public tx::Image_Resource_Base
+{
+    public:
+
+        typedef std::shared_ptr<Recording_Image_Resource<PixelT>> ptr_t;
+
+        /**
+         * Constructor
+        */
+        Recording_Image_Resource( int                      cols,
+                                  int                      rows,
+                                  const tmns::math::Size2i& block_size )
+          : m_image( cols, rows ),
+            m_block_size( block_size ) {}
+
+        tx::Image_Format format() const override
+        {
+            return m_image.format();
+        }
+
+        tx::Result<void> read( const tx::Image_Buffer&   dest,
+                               const tmns::math::Rect2i& bbox ) const override
+        {
+            {
+                std::lock_guard<std::mutex> lock( m_mtx );
+                m_read_order.push_back( bbox );
+            }
+            tx::Image_Memory<PixelT> block( tx::crop_image( m_image, bbox ) );
+            return tx::convert( dest, block.buffer(), false );
+        }
+
+        bool has_block_read() const override { return false; }
+
+        bool has_nodata_read() const override { return m_nodata.has_value(); }
+
+        double nodata_read() const override { return m_nodata.value(); }
+
+        /// Report a nodata value
+        void set_nodata_read( double value ) { m_nodata = value; }
+
+        bool has_empty_regions() const override { return true; }
+
+        bool is_empty( const tmns::math::Rect2i& bbox ) const override
+        {
+            for( const auto& region : m_empty_regions )
+            {
+                if( bbox.min().x() >= region.min().x() && bbox.max().x() <= region.max().x() &&
+                    bbox.min().y() >= region.min().y() && bbox.max().y() <= region.max().y() )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Report a region as holding no data
+        void mark_empty( const tmns::math::Rect2i& bbox ) { m_empty_regions.push_back( bbox ); }
+
+        tx::Result<void> write( const tx::Image_Buffer&   buf,
+                                const tmns::math::Rect2i& bbox ) override
+        {
+            std::lock_guard<std::mutex> lock( m_mtx );
+            m_write_order.push_back( bbox );
+            m_write_pointers.push_back( buf.data() );
+            tx::Image_Memory<PixelT> block( bbox.width(), bbox.height() );
+            auto res = tx::convert( block.buffer(), buf, false );
+            for( int r = 0; r < bbox.height(); ++r ) {
+            for( int c = 0; c < bbox.width();  ++c ) {
+                m_image( bbox.min().x() + c, bbox.min().y() + r ) = block( c, r );
+            }}
+            return res;
+        }
+
+        bool has_block_write() const override { return true; }
+
+        tmns::math::Size2i block_write_size() const override { return m_block_size; }
+
+        bool has_nodata_write() const override { return false; }
+
+        void flush() override {}
+
+        /// Image which received the writes
+        const tx::Image_Memory<PixelT>& image() const { return m_image; }
+
+        /// Order in which regions were read
+        const std::vector<tmns::math::Rect2i>& read_order() const { return m_read_order; }
+
+        /// Order in which blocks were written
+        const std::vector<tmns::math::Rect2i>& write_order() const { return m_write_order; }
+
+        /// Data pointer of each buffer passed to write()
+        const std::vector<void*>& write_pointers() const { return m_write_pointers; }
+
+    private:
+
+        tx::Image_Memory<PixelT>                 m_image;
+        tmns::math::Size2i                       m_block_size;
+        std::optional<double>                    m_nodata;
+        std::vector<tmns::math::Rect2i>          m_empty_regions;
+        std::vector<tmns::math::Rect2i>          m_write_order;
+        std::vector<void*>                       m_write_pointers;
+        mutable std::vector<tmns::math::Rect2i>  m_read_order;
+        mutable std::mutex                       m_mtx;
+
+}; // End of Recording_Image_Resource class
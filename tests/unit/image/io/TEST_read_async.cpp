@@ -0,0 +1,108 @@
+/**
+ * @file    TEST_read_async.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/types/image_memory.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
+namespace tx = tmns::image;
+
+/********************************************************/
+/*      Queue every tile of a resource in one batch     */
+/********************************************************/
+TEST( io_read_async, batch_read )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 64, 48, tmns::math::Size2i( { 64, 48 } ) );
+    tx::Image_Memory<uint16_t> source( 64, 48 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = r * source.cols() + c;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), tmns::math::Rect2i( 0, 0, 64, 48 ) ).has_error() );
+
+    std::vector<tx::Image_Memory<uint16_t>> tiles;
+    std::vector<tx::Image_Buffer>           dests;
+    std::vector<tmns::math::Rect2i>         bboxes;
+    tiles.reserve( 12 );
+    for( int j = 0; j < 48; j += 16 )
+    for( int i = 0; i < 64; i += 16 )
+    {
+        tiles.emplace_back( 16, 16 );
+        dests.push_back( tiles.back().buffer() );
+        bboxes.push_back( tmns::math::Rect2i( i, j, 16, 16 ) );
+    }
+
+    auto futures = resource->read_async( dests, bboxes );
+    ASSERT_EQ( futures.size(), tiles.size() );
+    for( size_t t = 0; t < futures.size(); t++ )
+    {
+        ASSERT_FALSE( futures[t].get().has_error() );
+        for( int r = 0; r < 16; r++ )
+        for( int c = 0; c < 16; c++ )
+        {
+            ASSERT_EQ( tiles[t]( c, r ), source( bboxes[t].min().x() + c, bboxes[t].min().y() + r ) );
+        }
+    }
+
+    // Single read
+    tx::Image_Memory<uint16_t> single( 10, 5 );
+    auto future = resource->read_async( single.buffer(), tmns::math::Rect2i( 3, 4, 10, 5 ) );
+    ASSERT_FALSE( future.get().has_error() );
+    ASSERT_EQ( single( 2, 1 ), source( 5, 5 ) );
+
+    // Missing bounding boxes fail their own futures only
+    futures = resource->read_async( dests, std::vector<tmns::math::Rect2i>( bboxes.begin(), bboxes.begin() + 2 ) );
+    ASSERT_EQ( futures.size(), dests.size() );
+    ASSERT_FALSE( futures[1].get().has_error() );
+    ASSERT_TRUE( futures[2].get().has_error() );
+}
+
+/********************************************************/
+/*      Reads of one resource run one at a time, and    */
+/*      the resource is kept alive until they are done  */
+/********************************************************/
+TEST( io_read_async, serialized_read )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 64, 64, tmns::math::Size2i( { 64, 64 } ) );
+    ASSERT_FALSE( resource->has_concurrent_read() );
+
+    std::vector<tx::Image_Memory<uint16_t>> tiles;
+    std::vector<tx::Image_Buffer>           dests;
+    std::vector<tmns::math::Rect2i>         bboxes;
+    tiles.reserve( 16 );
+    for( int j = 0; j < 64; j += 16 )
+    for( int i = 0; i < 64; i += 16 )
+    {
+        tiles.emplace_back( 16, 16 );
+        dests.push_back( tiles.back().buffer() );
+        bboxes.push_back( tmns::math::Rect2i( i, j, 16, 16 ) );
+    }
+
+    auto futures = resource->read_async( dests, bboxes );
+
+    // Reads run in submission order on a single strand
+    for( auto& future : futures )
+    {
+        ASSERT_FALSE( future.get().has_error() );
+    }
+    ASSERT_EQ( resource->read_order().size(), bboxes.size() );
+    for( size_t i = 0; i < bboxes.size(); i++ )
+    {
+        ASSERT_EQ( resource->read_order()[i].to_string(), bboxes[i].to_string() );
+    }
+
+    // Dropping every pointer while reads are pending is safe
+    futures = resource->read_async( dests, bboxes );
+    resource.reset();
+    for( auto& future : futures )
+    {
+        ASSERT_FALSE( future.get().has_error() );
+    }
+}
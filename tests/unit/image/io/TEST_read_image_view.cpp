@@ -0,0 +1,148 @@
+/**
+ * @file    TEST_read_image_view.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/read_image.hpp>
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/select_plane.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_tiled.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../UNIT_TEST_ONLY/Prerasterization_Test_View.hpp"
+#include "../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Read a resource region directly into a      */
+/*      crop of a larger, multi-plane mosaic.       */
+/****************************************************/
+TEST( io_read_image, read_into_memory_view )
+{
+    // Source resource, filled through its write interface
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 100, 80, tmns::math::Size2i( { 100, 80 } ) );
+    tx::Image_Memory<uint16_t> source( 100, 80 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = r * source.cols() + c + 1;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), tmns::math::Rect2i( 0, 0, 100, 80 ) ).has_error() );
+
+    // Destination mosaic, cleared to zero
+    tx::Image_Memory<uint16_t> mosaic( 300, 200, 2 );
+    for( int p = 0; p < mosaic.planes(); p++ )
+    for( int r = 0; r < mosaic.rows(); r++ )
+    for( int c = 0; c < mosaic.cols(); c++ )
+    {
+        mosaic( c, r, p ) = 0;
+    }
+
+    // Read a 40x30 region into plane 1 of the mosaic at (120, 50)
+    tmns::math::Rect2i src_bbox( 10, 20, 40, 30 );
+    auto dest_view = tx::crop_image( tx::ops::select_plane( mosaic, 1 ),
+                                     tmns::math::Rect2i( 120, 50, 40, 30 ) );
+    auto result = tx::io::read_image( dest_view, resource, src_bbox );
+    ASSERT_FALSE( result.has_error() );
+
+    for( int p = 0; p < mosaic.planes(); p++ )
+    for( int r = 0; r < mosaic.rows(); r++ )
+    for( int c = 0; c < mosaic.cols(); c++ )
+    {
+        bool inside = ( p == 1 && c >= 120 && c < 160 && r >= 50 && r < 80 );
+        uint16_t expected = inside ? source( c - 120 + 10, r - 50 + 20 ) : 0;
+        ASSERT_EQ( mosaic( c, r, p ), expected );
+    }
+
+    // Mismatched destination sizes are rejected
+    ASSERT_TRUE( tx::io::read_image( dest_view, resource, tmns::math::Rect2i( 0, 0, 10, 10 ) ).has_error() );
+}
+
+/****************************************************/
+/*      Read a resource region into a crop of an    */
+/*      image without a memory buffer, through the  */
+/*      intermediate buffer.                        */
+/****************************************************/
+TEST( io_read_image, read_into_unbuffered_view )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint8_t>>( 40, 30, tmns::math::Size2i( { 40, 30 } ) );
+    tx::Image_Memory<uint8_t> source( 40, 30 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = ( r * source.cols() + c ) % 200 + 1;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), tmns::math::Rect2i( 0, 0, 40, 30 ) ).has_error() );
+
+    // The test view exposes its pixels through an accessor only
+    Prerasterization_Test_View<uint8_t> canvas( 25, 20 );
+    for( int r = 0; r < canvas.rows(); r++ )
+    for( int c = 0; c < canvas.cols(); c++ )
+    {
+        canvas.image()( c, r ) = 0;
+    }
+    auto dest_view = tx::crop_image( canvas, tmns::math::Rect2i( 5, 6, 12, 8 ) );
+    ASSERT_FALSE( tx::Is_Memory_Buffered<decltype( dest_view )>::value::value );
+
+    tmns::math::Rect2i src_bbox( 20, 15, 12, 8 );
+    auto result = tx::io::read_image( dest_view, resource, src_bbox );
+    ASSERT_FALSE( result.has_error() );
+
+    for( int r = 0; r < canvas.rows(); r++ )
+    for( int c = 0; c < canvas.cols(); c++ )
+    {
+        bool inside = ( c >= 5 && c < 17 && r >= 6 && r < 14 );
+        uint8_t expected = inside ? source( c - 5 + 20, r - 6 + 15 ) : 0;
+        ASSERT_EQ( canvas.image()( c, r ), expected );
+    }
+
+    // Mismatched destination sizes are rejected
+    ASSERT_TRUE( tx::io::read_image( dest_view, resource, tmns::math::Rect2i( 0, 0, 10, 10 ) ).has_error() );
+}
+
+/****************************************************/
+/*      Read a resource region into a crop of a     */
+/*      tiled image, of another pixel type, with    */
+/*      a single read.                              */
+/****************************************************/
+TEST( io_read_image, read_into_tiled_view )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 100, 80, tmns::math::Size2i( { 100, 80 } ) );
+    tx::Image_Memory<uint16_t> source( 100, 80 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = r * source.cols() + c + 1;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), tmns::math::Rect2i( 0, 0, 100, 80 ) ).has_error() );
+
+    // Tiled images have no single strided buffer, so neither do crops of them
+    tx::Image_Tiled<float,16> mosaic( 120, 90 );
+    auto dest_view = tx::crop_image( mosaic, tmns::math::Rect2i( 30, 25, 50, 40 ) );
+    ASSERT_FALSE( tx::Is_Memory_Buffered<decltype( dest_view )>::value::value );
+
+    tmns::math::Rect2i src_bbox( 45, 35, 50, 40 );
+    auto result = tx::io::read_image( dest_view, resource, src_bbox );
+    ASSERT_FALSE( result.has_error() );
+
+    for( int r = 0; r < mosaic.rows(); r++ )
+    for( int c = 0; c < mosaic.cols(); c++ )
+    {
+        bool inside = ( c >= 30 && c < 80 && r >= 25 && r < 65 );
+        float expected = inside ? source( c - 30 + 45, r - 25 + 35 ) : 0;
+        ASSERT_EQ( mosaic( c, r ), expected );
+    }
+
+    // One read of the whole region, not one per tile
+    ASSERT_EQ( resource->read_order().size(), 1 );
+    ASSERT_EQ( resource->read_order()[0].to_string(), src_bbox.to_string() );
+
+    // Mismatched destination sizes are rejected before reading
+    ASSERT_TRUE( tx::io::read_image( dest_view, resource, tmns::math::Rect2i( 0, 0, 10, 10 ) ).has_error() );
+    ASSERT_EQ( resource->read_order().size(), 1 );
+}
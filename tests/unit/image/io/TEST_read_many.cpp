@@ -0,0 +1,58 @@
+/**
+ * @file    TEST_read_many.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/types/image_memory.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
+namespace tx = tmns::image;
+
+/************************************************************/
+/*      Adjacent and overlapping regions share one read,    */
+/*      distant regions are read on their own.              */
+/************************************************************/
+TEST( io_read_many, coalesce_adjacent )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint8_t>>( 100, 100, tmns::math::Size2i( { 100, 100 } ) );
+    tx::Image_Memory<uint8_t> source( 100, 100 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = ( r * 7 + c * 3 ) % 251;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), tmns::math::Rect2i( 0, 0, 100, 100 ) ).has_error() );
+
+    std::vector<tmns::math::Rect2i> bboxes { tmns::math::Rect2i( 10, 10, 10, 10 ),
+                                             tmns::math::Rect2i( 20, 10, 10, 10 ),
+                                             tmns::math::Rect2i( 10, 20, 20, 10 ),
+                                             tmns::math::Rect2i( 80, 80, 10, 10 ) };
+    std::vector<tx::Image_Memory<uint8_t>> chips;
+    std::vector<tx::Image_Buffer>          dests;
+    chips.reserve( bboxes.size() );
+    for( const auto& bbox : bboxes )
+    {
+        chips.emplace_back( bbox.width(), bbox.height() );
+        dests.push_back( chips.back().buffer() );
+    }
+
+    ASSERT_FALSE( resource->read_many( bboxes, dests ).has_error() );
+    ASSERT_EQ( resource->read_order().size(), 2 );
+    ASSERT_EQ( resource->read_order()[0].to_string(), tmns::math::Rect2i( 10, 10, 20, 20 ).to_string() );
+    ASSERT_EQ( resource->read_order()[1].to_string(), bboxes[3].to_string() );
+
+    for( size_t i = 0; i < bboxes.size(); i++ )
+    for( int r = 0; r < bboxes[i].height(); r++ )
+    for( int c = 0; c < bboxes[i].width(); c++ )
+    {
+        ASSERT_EQ( chips[i]( c, r ), source( bboxes[i].min().x() + c, bboxes[i].min().y() + r ) );
+    }
+
+    // Mismatched inputs are rejected
+    ASSERT_TRUE( resource->read_many( bboxes, std::span<const tx::Image_Buffer>( dests.data(), 2 ) ).has_error() );
+}
@@ -0,0 +1,254 @@
+/**
+ * @file    TEST_write_image.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/raw/image_resource_disk_raw.hpp>
+#include <terminus/image/io/write_image.hpp>
+#include <terminus/image/operations/per_pixel_views/per_pixel_view_unary.hpp>
+#include <terminus/image/operations/statistics/channel_operations.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_resource_view.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
+// C++ Libraries
+#include <filesystem>
+#include <string>
+
+// POSIX Libraries
+#include <unistd.h>
+
+namespace tx = tmns::image;
+
+/**
+ * Inverts each pixel value
+*/
+struct Invert_Functor
+{
+    uint8_t operator()( uint8_t pix ) const
+    {
+        return 255 - pix;
+    }
+};
+
+/****************************************************/
+/*      Rasterize a lazy view in blocks using       */
+/*      several threads, and verify the writer      */
+/*      thread commits them in order.               */
+/****************************************************/
+TEST( io_write_image, parallel_block_write )
+{
+    tx::Image_Memory<uint16_t> image_01( 250, 130 );
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r ) = r * image_01.cols() + c;
+    }
+
+    // Read the source through a resource view, so each block is rasterized on the pool
+    auto source = std::make_shared<Recording_Image_Resource<uint16_t>>( 250, 130, tmns::math::Size2i( { 250, 130 } ) );
+    ASSERT_FALSE( source->write( image_01.buffer(), tmns::math::Rect2i( 0, 0, 250, 130 ) ).has_error() );
+    tx::Image_Resource_View<uint16_t> view( source );
+    ASSERT_FALSE( tx::Is_Memory_Buffered<decltype( view )>::value::value );
+
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 250, 130, tmns::math::Size2i( { 64, 32 } ) );
+
+    tmns::core::utility::Progress_Callback_Null progress;
+    auto result = tx::io::write_image( resource, view, progress, 4 );
+    ASSERT_FALSE( result.has_error() );
+
+    // 4 x 5 blocks, committed left-to-right, top-to-bottom
+    const auto& order = resource->write_order();
+    ASSERT_EQ( order.size(), 20 );
+    for( size_t i = 0; i < order.size(); ++i )
+    {
+        ASSERT_EQ( order[i].min().x(), ( i % 4 ) * 64 );
+        ASSERT_EQ( order[i].min().y(), ( i / 4 ) * 32 );
+    }
+
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        ASSERT_EQ( resource->image()( c, r ), image_01( c, r ) );
+    }
+}
+
+/****************************************************/
+/*      Write a crop of an in-memory image and      */
+/*      verify the source pixels are not copied.    */
+/****************************************************/
+TEST( io_write_image, memory_buffer_write )
+{
+    tx::Image_Memory<uint16_t> image_01( 300, 200 );
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r ) = r * image_01.cols() + c;
+    }
+
+    tmns::math::Rect2i bbox( 40, 30, 200, 100 );
+    auto crop_view = tx::crop_image( image_01, bbox );
+
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 200, 100, tmns::math::Size2i( { 100, 50 } ) );
+    auto result = tx::io::write_image( resource, crop_view );
+    ASSERT_FALSE( result.has_error() );
+
+    // Each block should reference the original image memory
+    const auto& order    = resource->write_order();
+    const auto& pointers = resource->write_pointers();
+    ASSERT_EQ( order.size(), 4 );
+    for( size_t i = 0; i < order.size(); ++i )
+    {
+        ASSERT_EQ( pointers[i], &image_01( bbox.min().x() + order[i].min().x(),
+                                           bbox.min().y() + order[i].min().y() ) );
+    }
+
+    for( int r = 0; r < bbox.height(); r++ )
+    for( int c = 0; c < bbox.width();  c++ )
+    {
+        ASSERT_EQ( resource->image()( c, r ), crop_view( c, r ) );
+    }
+}
+
+/****************************************************/
+/*      Split a multi-plane image across one        */
+/*      resource per plane in a single pass.        */
+/****************************************************/
+TEST( io_write_image, multi_plane_block_write )
+{
+    tx::Image_Memory<uint8_t> image_01( 120, 90, 3 );
+    for( int p = 0; p < image_01.planes(); p++ )
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r, p ) = ( r + c + 50 * p ) % 256;
+    }
+
+    std::vector<tx::Write_Image_Resource_Base::ptr_t> resources;
+    std::vector<Recording_Image_Resource<uint8_t>::ptr_t> recorders;
+    for( int p = 0; p < image_01.planes(); p++ )
+    {
+        recorders.push_back( std::make_shared<Recording_Image_Resource<uint8_t>>( 120, 90, tmns::math::Size2i( { 32, 32 } ) ) );
+        resources.push_back( recorders.back() );
+    }
+
+    tx::io::Block_Write_Queue<tx::Image_Memory<uint8_t>> write_queue( resources,
+                                                                      image_01,
+                                                                      tmns::math::Size2i( { 32, 32 } ),
+                                                                      3 );
+    tmns::core::utility::Progress_Callback_Null progress;
+    auto result = write_queue( progress );
+    ASSERT_FALSE( result.has_error() );
+
+    for( int p = 0; p < image_01.planes(); p++ )
+    {
+        ASSERT_EQ( recorders[p]->write_order().size(), write_queue.num_blocks() );
+        for( int r = 0; r < image_01.rows(); r++ )
+        for( int c = 0; c < image_01.cols(); c++ )
+        {
+            ASSERT_EQ( recorders[p]->image()( c, r ), image_01( c, r, p ) );
+        }
+    }
+}
+
+/****************************************************/
+/*      Write a lazy multi-plane view through a     */
+/*      wildcard path, one file per plane.          */
+/****************************************************/
+TEST( io_write_image, wildcard_plane_write )
+{
+    tx::Image_Memory<uint8_t> image_01( 90, 70, 3 );
+    for( int p = 0; p < image_01.planes(); p++ )
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r, p ) = ( r + c + 50 * p ) % 256;
+    }
+
+    // Not memory-buffered, so the planes are split in a single pass
+    auto view = tx::ops::per_pixel_view( image_01, Invert_Functor() );
+    ASSERT_FALSE( tx::Is_Memory_Buffered<decltype( view )>::value::value );
+
+    const std::string stem = ( std::filesystem::temp_directory_path() /
+                               ( "terminus_wildcard_" + std::to_string( ::getpid() ) + "_" ) ).native();
+    tmns::core::utility::Progress_Callback_Null progress;
+    auto result = tx::io::write_image( stem + "*.raw",
+                                       view,
+                                       {},
+                                       tx::io::Disk_Driver_Manager::create_write_defaults(),
+                                       progress,
+                                       2 );
+    ASSERT_FALSE( result.has_error() );
+
+    for( int p = 0; p < image_01.planes(); p++ )
+    {
+        const std::filesystem::path pathname( stem + std::to_string( p ) + ".raw" );
+        {
+            auto reader = tx::io::raw::Image_Resource_Disk_Raw::create( pathname );
+            ASSERT_FALSE( reader.has_error() );
+            ASSERT_EQ( reader.value()->cols(), 90 );
+            ASSERT_EQ( reader.value()->rows(), 70 );
+            ASSERT_EQ( reader.value()->planes(), 1 );
+
+            tx::Image_Memory<uint8_t> plane( 90, 70 );
+            ASSERT_FALSE( reader.value()->read( plane.buffer(), plane.full_bbox() ).has_error() );
+            for( int r = 0; r < plane.rows(); r++ )
+            for( int c = 0; c < plane.cols(); c++ )
+            {
+                ASSERT_EQ( plane( c, r ), 255 - image_01( c, r, p ) );
+            }
+        }
+        std::filesystem::remove( pathname );
+        std::filesystem::remove( std::filesystem::path( pathname ).replace_extension( ".hdr" ) );
+    }
+}
+
+/****************************************************/
+/*      Write and measure an image whose bottom     */
+/*      half is empty and verify it is never read.  */
+/****************************************************/
+TEST( io_write_image, skip_empty_blocks )
+{
+    tx::Image_Memory<uint8_t> image_01( 64, 64 );
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r ) = r < 32 ? 7 : 0;
+    }
+
+    auto source = std::make_shared<Recording_Image_Resource<uint8_t>>( 64, 64, tmns::math::Size2i( { 64, 16 } ) );
+    ASSERT_FALSE( source->write( image_01.buffer(), tmns::math::Rect2i( 0, 0, 64, 64 ) ).has_error() );
+    source->mark_empty( tmns::math::Rect2i( 0, 32, 64, 32 ) );
+
+    tx::Image_Resource_View<uint8_t> view( source );
+    ASSERT_TRUE( view.is_empty( tmns::math::Rect2i( 0, 40, 64, 8 ) ) );
+    ASSERT_FALSE( view.is_empty( tmns::math::Rect2i( 0, 24, 64, 16 ) ) );
+
+    // Write in blocks of 16 rows
+    auto dest = std::make_shared<Recording_Image_Resource<uint8_t>>( 64, 64, tmns::math::Size2i( { 64, 16 } ) );
+    tmns::core::utility::Progress_Callback_Null progress;
+    ASSERT_FALSE( tx::io::write_image( dest, view, progress, 2 ).has_error() );
+    ASSERT_EQ( dest->write_order().size(), 4 );
+
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        ASSERT_EQ( dest->image()( c, r ), image_01( c, r ) );
+    }
+
+    // Statistics see the fill value for empty rows
+    uint8_t min_value, max_value;
+    tx::ops::min_max_channel_values( view, min_value, max_value );
+    ASSERT_EQ( min_value, 0 );
+    ASSERT_EQ( max_value, 7 );
+
+    for( const auto& bbox : source->read_order() )
+    {
+        ASSERT_LE( bbox.max().y(), 32 );
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file    TEST_Disk_Driver_Manager.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/disk_driver_manager.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../../UNIT_TEST_ONLY/Null_Disk_Resource.hpp"
+
+// C++ Libraries
+#include <atomic>
+#include <fstream>
+
+namespace tx = tmns::image;
+
+namespace tmns::image::io {
+
+/**
+ * Factory which counts how often it is probed and asked to open files
+*/
+class Counting_Factory : public Driver_Factory_Base
+{
+    public:
+
+        bool is_read_image_supported( const std::filesystem::path& pathname ) const override
+        {
+            ++m_probes;
+            return pathname.extension() == ".probe";
+        }
+
+        bool is_write_image_supported( const std::filesystem::path& pathname ) const override
+        {
+            return false;
+        }
+
+        Result<DriverT> create_read_driver( const std::filesystem::path& pathname ) const override
+        {
+            ++m_opens;
+            return outcome::ok<DriverT>( std::make_shared<Null_Disk_Resource>( pathname ) );
+        }
+
+        Result<DriverT> create_write_driver( const std::filesystem::path&,
+                                             const Image_Format&,
+                                             const std::map<std::string,std::string>&,
+                                             const math::Size2i& ) const override
+        {
+            return outcome::fail( error::Error_Code::NOT_IMPLEMENTED, "Read only" );
+        }
+
+        mutable std::atomic<int> m_probes { 0 };
+        mutable std::atomic<int> m_opens { 0 };
+
+}; // End of Counting_Factory class
+
+} // End of tmns::image::io namespace
+
+/****************************************************************/
+/*      Files matching a known signature skip factory probing   */
+/****************************************************************/
+TEST( io_Disk_Driver_Manager, probe_cache )
+{
+    auto path_a = std::filesystem::temp_directory_path() / "terminus_probe_a.probe";
+    auto path_b = std::filesystem::temp_directory_path() / "terminus_probe_b.probe";
+    for( const auto& pathname : { path_a, path_b } )
+    {
+        std::ofstream fout( pathname, std::ios::binary );
+        fout << "PROBEMAGIC-0001-payload-" << pathname.stem().string();
+    }
+
+    auto factory = std::make_shared<tx::io::Counting_Factory>();
+    auto manager = tx::io::Disk_Driver_Manager::create_read_defaults();
+    manager->set_handle_cache( nullptr );
+    manager->register_read_driver_factory( factory );
+
+    ASSERT_FALSE( manager->pick_read_driver( path_a ).has_error() );
+    ASSERT_EQ( factory->m_probes, 1 );
+    ASSERT_EQ( factory->m_opens, 1 );
+
+    // Same extension and leading bytes
+    ASSERT_FALSE( manager->pick_read_driver( path_b ).has_error() );
+    ASSERT_EQ( factory->m_probes, 1 );
+    ASSERT_EQ( factory->m_opens, 2 );
+
+    std::filesystem::remove( path_a );
+    std::filesystem::remove( path_b );
+}
+
+/****************************************************************/
+/*      Cached handles are returned without opening again       */
+/****************************************************************/
+TEST( io_Disk_Driver_Manager, handle_cache )
+{
+    auto pathname = std::filesystem::temp_directory_path() / "terminus_handle.probe";
+    {
+        std::ofstream fout( pathname, std::ios::binary );
+        fout << "HANDLE";
+    }
+
+    auto factory = std::make_shared<tx::io::Counting_Factory>();
+    auto manager = tx::io::Disk_Driver_Manager::create_read_defaults();
+    manager->set_handle_cache( std::make_shared<tx::io::Resource_Handle_Cache>( 8 ) );
+    manager->register_read_driver_factory( factory );
+
+    auto first  = manager->pick_read_driver( pathname );
+    auto second = manager->pick_read_driver( pathname );
+    ASSERT_FALSE( first.has_error() );
+    ASSERT_FALSE( second.has_error() );
+    ASSERT_EQ( first.value(), second.value() );
+    ASSERT_EQ( factory->m_opens, 1 );
+
+    std::filesystem::remove( pathname );
+}
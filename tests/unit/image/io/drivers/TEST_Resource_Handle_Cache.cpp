@@ -0,0 +1,82 @@
+/**
+ * @file    TEST_Resource_Handle_Cache.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/resource_handle_cache.hpp>
+
+// Terminus Unit-Test Libraries
+#include "../../../UNIT_TEST_ONLY/Null_Disk_Resource.hpp"
+
+// C++ Libraries
+#include <fstream>
+
+namespace tx = tmns::image;
+
+/**
+ * Create or rewrite a small file
+*/
+static std::filesystem::path touch_file( const std::string& name, const std::string& contents )
+{
+    auto pathname = std::filesystem::temp_directory_path() / name;
+    std::ofstream fout( pathname );
+    fout << contents;
+    return pathname;
+}
+
+/********************************************************/
+/*      Repeated lookups return the same open handle    */
+/********************************************************/
+TEST( io_Resource_Handle_Cache, hit_and_stale )
+{
+    tx::io::Resource_Handle_Cache cache( 4 );
+    auto pathname = touch_file( "terminus_handle_cache_a.dat", "a" );
+
+    ASSERT_EQ( cache.find( pathname, { "null" } ), nullptr );
+    auto resource = std::make_shared<tx::io::Null_Disk_Resource>( pathname );
+    ASSERT_EQ( cache.insert( pathname, "null", resource ), resource );
+    ASSERT_EQ( cache.find( pathname, { "null" } ), resource );
+
+    // Other drivers do not see the entry
+    ASSERT_EQ( cache.find( pathname, { "other" } ), nullptr );
+
+    // Rewriting the file invalidates the entry
+    touch_file( "terminus_handle_cache_a.dat", "changed" );
+    ASSERT_EQ( cache.find( pathname, { "null" } ), nullptr );
+    ASSERT_EQ( cache.size(), 0 );
+
+    std::filesystem::remove( pathname );
+}
+
+/****************************************************/
+/*      Least-recently-used entries are evicted     */
+/****************************************************/
+TEST( io_Resource_Handle_Cache, lru_budget )
+{
+    tx::io::Resource_Handle_Cache cache( 2 );
+    auto path_a = touch_file( "terminus_handle_cache_a.dat", "a" );
+    auto path_b = touch_file( "terminus_handle_cache_b.dat", "b" );
+    auto path_c = touch_file( "terminus_handle_cache_c.dat", "c" );
+
+    cache.insert( path_a, "null", std::make_shared<tx::io::Null_Disk_Resource>( path_a ) );
+    cache.insert( path_b, "null", std::make_shared<tx::io::Null_Disk_Resource>( path_b ) );
+
+    // Touch A so B becomes the oldest
+    ASSERT_NE( cache.find( path_a, { "null" } ), nullptr );
+    cache.insert( path_c, "null", std::make_shared<tx::io::Null_Disk_Resource>( path_c ) );
+
+    ASSERT_EQ( cache.size(), 2 );
+    ASSERT_NE( cache.find( path_a, { "null" } ), nullptr );
+    ASSERT_EQ( cache.find( path_b, { "null" } ), nullptr );
+    ASSERT_NE( cache.find( path_c, { "null" } ), nullptr );
+
+    cache.set_max_open( 0 );
+    ASSERT_EQ( cache.size(), 0 );
+
+    std::filesystem::remove( path_a );
+    std::filesystem::remove( path_b );
+    std::filesystem::remove( path_c );
+}
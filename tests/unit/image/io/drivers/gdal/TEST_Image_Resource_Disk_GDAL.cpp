@@ -7,6 +7,8 @@
 
 // Terminus Libraries
 #include <terminus/image/io/drivers/gdal/Image_Resource_Disk_GDAL.hpp>
+#include <terminus/image/pixel/Pixel_RGB.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
 #include <terminus/log/utility.hpp>
 
 namespace tx = tmns::image;
@@ -30,4 +32,50 @@ TEST( io_gdal_Image_Resource_Disk_GDAL, read_construction_jpg )
     ASSERT_EQ( resource.format().pixel_type(), tx::Pixel_Format_Enum::RGB );
     ASSERT_EQ( resource.format().channel_type(), tx::Channel_Type_Enum::UINT8 );
     ASSERT_EQ( resource.format().premultiply(), true );
-}
\ No newline at end of file
+}
+/*********************************************************/
+/*          Metadata is loaded on first access           */
+/*********************************************************/
+TEST( io_gdal_Image_Resource_Disk_GDAL, lazy_metadata )
+{
+    std::filesystem::path image_to_load { "./data/images/jpeg/lena.jpg" };
+
+    auto resource = tx::io::gdal::Image_Resource_Disk_GDAL::create( image_to_load );
+    ASSERT_FALSE( resource.has_error() );
+
+    auto metadata = resource.value()->metadata();
+    ASSERT_EQ( metadata->get<std::string>( "file_driver" ).value(), "JPEG" );
+
+    // Repeated access returns the same container
+    ASSERT_EQ( resource.value()->metadata(), metadata );
+}
+
+/*********************************************************/
+/*      Block reads match reads of the same region       */
+/*********************************************************/
+TEST( io_gdal_Image_Resource_Disk_GDAL, read_block )
+{
+    std::filesystem::path image_to_load { "./data/images/jpeg/lena.jpg" };
+
+    tx::io::gdal::Image_Resource_Disk_GDAL resource( image_to_load );
+    ASSERT_TRUE( resource.has_block_read() );
+
+    const auto block_size = resource.block_read_size();
+    auto bbox = tmns::math::Rect2i::intersection( tmns::math::Rect2i( 0, 0, block_size.width(), block_size.height() ),
+                                                  resource.full_bbox() );
+
+    tx::Image_Memory<tx::PixelRGB_u8> block( bbox.width(), bbox.height() );
+    tx::Image_Memory<tx::PixelRGB_u8> region( bbox.width(), bbox.height() );
+    ASSERT_FALSE( resource.read_block( 0, 0, block.buffer() ).has_error() );
+    ASSERT_FALSE( resource.read( region.buffer(), bbox ).has_error() );
+
+    for( int r = 0; r < bbox.height(); r++ )
+    for( int c = 0; c < bbox.width(); c++ )
+    {
+        ASSERT_TRUE( block( c, r ) == region( c, r ) );
+    }
+
+    // Blocks past the edge of the image are rejected
+    const int blocks_x = ( resource.cols() - 1 ) / block_size.width() + 1;
+    ASSERT_TRUE( resource.read_block( blocks_x, 0, block.buffer() ).has_error() );
+}
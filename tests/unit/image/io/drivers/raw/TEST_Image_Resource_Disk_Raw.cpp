@@ -0,0 +1,183 @@
+/**
+ * @file    TEST_Image_Resource_Disk_Raw.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/io/drivers/raw/image_resource_disk_raw.hpp>
+#include <terminus/image/pixel/pixel_rgb.hpp>
+#include <terminus/image/types/image_memory.hpp>
+
+// C++ Libraries
+#include <filesystem>
+#include <string>
+
+// POSIX Libraries
+#include <unistd.h>
+
+namespace tx = tmns::image;
+
+/**********************************************************/
+/*      Write a multi-plane raster, then read it back     */
+/*      through both the copy and zero-copy paths.        */
+/**********************************************************/
+TEST( io_raw_Image_Resource_Disk_Raw, write_read_round_trip )
+{
+    auto pathname = std::filesystem::temp_directory_path() / ( "terminus_raw_round_trip_" + std::to_string( ::getpid() ) + ".raw" );
+
+    tx::Image_Memory<uint16_t> source( 64, 48, 2 );
+    for( int p = 0; p < source.planes(); p++ )
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r, p ) = p * 10000 + r * source.cols() + c;
+    }
+
+    {
+        auto writer = tx::io::raw::Image_Resource_Disk_Raw::create( pathname,
+                                                                    source.format(),
+                                                                    {},
+                                                                    tmns::math::Size2i( { 0, 0 } ) );
+        ASSERT_FALSE( writer.has_error() );
+        ASSERT_FALSE( writer.value()->write( source.buffer(), source.format().bbox() ).has_error() );
+    }
+
+    auto reader = tx::io::raw::Image_Resource_Disk_Raw::create( pathname );
+    ASSERT_FALSE( reader.has_error() );
+    auto resource = std::dynamic_pointer_cast<tx::io::raw::Image_Resource_Disk_Raw>( reader.value() );
+    ASSERT_TRUE( resource );
+    ASSERT_EQ( resource->resource_name(), "Raw" );
+    ASSERT_EQ( resource->cols(), 64 );
+    ASSERT_EQ( resource->rows(), 48 );
+    ASSERT_EQ( resource->planes(), 2 );
+    ASSERT_EQ( resource->format().channel_type(), tx::Channel_Type_Enum::UINT16 );
+
+    // Copy a sub-region out of the mapping
+    tmns::math::Rect2i bbox( 5, 7, 20, 10 );
+    tx::Image_Memory<uint16_t> dest( 20, 10, 2 );
+    ASSERT_FALSE( resource->read( dest.buffer(), bbox ).has_error() );
+    for( int p = 0; p < dest.planes(); p++ )
+    for( int r = 0; r < dest.rows(); r++ )
+    for( int c = 0; c < dest.cols(); c++ )
+    {
+        ASSERT_EQ( dest( c, r, p ), source( c + 5, r + 7, p ) );
+    }
+
+    // View the same region in place
+    auto view = resource->buffer( bbox );
+    ASSERT_FALSE( view.has_error() );
+    const uint8_t* base = static_cast<const uint8_t*>( view.value().data() );
+    ASSERT_EQ( *reinterpret_cast<const uint16_t*>( base + 3 * view.value().rstride() + 4 * view.value().cstride() + view.value().pstride() ),
+               source( 9, 10, 1 ) );
+
+    // Regions outside the raster are rejected
+    ASSERT_TRUE( resource->buffer( tmns::math::Rect2i( 60, 0, 10, 10 ) ).has_error() );
+
+    // Empty and out-of-bounds hints are ignored
+    resource->prefetch( tmns::math::Rect2i( 10, 10, 0, 0 ) );
+    resource->prefetch( tmns::math::Rect2i( 0, 0, 64, 0 ) );
+    resource->prefetch( tmns::math::Rect2i( 60, 40, 10, 10 ) );
+
+    resource.reset();
+    ASSERT_TRUE( reader.has_error() );
+    std::filesystem::remove( pathname );
+    std::filesystem::remove( std::filesystem::path( pathname ).replace_extension( ".hdr" ) );
+}
+
+/**********************************************************/
+/*      Read a batch of tiles asynchronously, from both   */
+/*      band-sequential and pixel-interleaved files.      */
+/**********************************************************/
+TEST( io_raw_Image_Resource_Disk_Raw, read_async_batch )
+{
+    const auto stem = std::filesystem::temp_directory_path() / ( "terminus_raw_async_" + std::to_string( ::getpid() ) );
+    const auto bsq_path = std::filesystem::path( stem ).replace_extension( ".bsq.raw" );
+    const auto bip_path = std::filesystem::path( stem ).replace_extension( ".bip.raw" );
+
+    // Band-sequential, two planes
+    tx::Image_Memory<uint16_t> source( 100, 70, 2 );
+    for( int p = 0; p < source.planes(); p++ )
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r, p ) = p * 10000 + r * source.cols() + c;
+    }
+    {
+        auto writer = tx::io::raw::Image_Resource_Disk_Raw::create( bsq_path, source.format(), {},
+                                                                    tmns::math::Size2i( { 0, 0 } ) );
+        ASSERT_FALSE( writer.has_error() );
+        ASSERT_FALSE( writer.value()->write( source.buffer(), source.format().bbox() ).has_error() );
+    }
+
+    auto reader = tx::io::raw::Image_Resource_Disk_Raw::create( bsq_path );
+    ASSERT_FALSE( reader.has_error() );
+
+    // Every tile of the image, including a full-width strip, plus one region outside it
+    std::vector<tx::Image_Memory<float>> tiles;
+    std::vector<tx::Image_Buffer>        dests;
+    std::vector<tmns::math::Rect2i>      bboxes;
+    tiles.reserve( 32 );
+    for( int j = 0; j < 60; j += 20 )
+    for( int i = 0; i < 100; i += 25 )
+    {
+        bboxes.push_back( tmns::math::Rect2i( i, j, 25, 20 ) );
+    }
+    bboxes.push_back( tmns::math::Rect2i( 0, 60, 100, 10 ) );
+    bboxes.push_back( tmns::math::Rect2i( 90, 60, 20, 10 ) );
+    for( const auto& bbox : bboxes )
+    {
+        tiles.emplace_back( bbox.width(), bbox.height(), 2 );
+        dests.push_back( tiles.back().buffer() );
+    }
+
+    auto futures = reader.value()->read_async( dests, bboxes );
+    ASSERT_EQ( futures.size(), bboxes.size() );
+    for( size_t t = 0; t + 1 < futures.size(); t++ )
+    {
+        ASSERT_FALSE( futures[t].get().has_error() );
+        for( int p = 0; p < 2; p++ )
+        for( int r = 0; r < bboxes[t].height(); r++ )
+        for( int c = 0; c < bboxes[t].width();  c++ )
+        {
+            ASSERT_EQ( tiles[t]( c, r, p ), source( bboxes[t].min().x() + c, bboxes[t].min().y() + r, p ) );
+        }
+    }
+    ASSERT_TRUE( futures.back().get().has_error() );
+
+    // Pixel-interleaved, three channels
+    tx::Image_Memory<tx::PixelRGB_u8> color( 40, 30 );
+    for( int r = 0; r < color.rows(); r++ )
+    for( int c = 0; c < color.cols(); c++ )
+    {
+        color( c, r ) = tx::PixelRGB_u8( r, c, r + c );
+    }
+    {
+        auto writer = tx::io::raw::Image_Resource_Disk_Raw::create( bip_path, color.format(), {},
+                                                                    tmns::math::Size2i( { 0, 0 } ) );
+        ASSERT_FALSE( writer.has_error() );
+        ASSERT_FALSE( writer.value()->write( color.buffer(), color.format().bbox() ).has_error() );
+    }
+
+    reader = tx::io::raw::Image_Resource_Disk_Raw::create( bip_path );
+    ASSERT_FALSE( reader.has_error() );
+    ASSERT_EQ( reader.value()->planes(), 3 );
+
+    tx::Image_Memory<uint8_t> bands( 12, 9, 3 );
+    auto future = reader.value()->read_async( bands.buffer(), tmns::math::Rect2i( 20, 15, 12, 9 ) );
+    ASSERT_FALSE( future.get().has_error() );
+    for( int r = 0; r < bands.rows(); r++ )
+    for( int c = 0; c < bands.cols(); c++ )
+    {
+        ASSERT_EQ( bands( c, r, 0 ), r + 15 );
+        ASSERT_EQ( bands( c, r, 1 ), c + 20 );
+        ASSERT_EQ( bands( c, r, 2 ), r + c + 35 );
+    }
+
+    for( const auto& path : { bsq_path, bip_path } )
+    {
+        std::filesystem::remove( path );
+        std::filesystem::remove( std::filesystem::path( path ).replace_extension( ".hdr" ) );
+    }
+}
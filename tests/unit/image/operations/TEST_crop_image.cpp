@@ -137,6 +137,33 @@ TEST( ops_Crop_View, image_memory_test )
   */
 }
 
+/********************************************/
+/*      Crops of crops collapse into one    */
+/********************************************/
+TEST( ops_Crop_View, crop_of_crop )
+{
+    tx::Image_Memory<uint16_t> image( 20, 10 );
+    for( int r = 0; r < image.rows(); r++ )
+    for( int c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = r * 100 + c;
+    }
+
+    auto crop_01 = tx::crop_image( image, 2, 3, 15, 6 );
+    auto crop_02 = tx::crop_image( crop_01, 4, 1, 5, 4 );
+    static_assert( std::is_same_v<decltype( crop_02 ), tx::ops::Crop_View<tx::Image_Memory<uint16_t>>> );
+    ASSERT_EQ( crop_02.offset_i(), 6 );
+    ASSERT_EQ( crop_02.offset_j(), 4 );
+    ASSERT_EQ( crop_02.cols(), 5 );
+    ASSERT_EQ( crop_02.rows(), 4 );
+    ASSERT_EQ( crop_02( 0, 0 ), 406 );
+    ASSERT_EQ( crop_02( 4, 3 ), 710 );
+
+    auto crop_03 = tx::crop_image( crop_02, tmns::math::Rect2i( 1, 1, 2, 2 ) );
+    static_assert( std::is_same_v<decltype( crop_03 ), tx::ops::Crop_View<tx::Image_Memory<uint16_t>>> );
+    ASSERT_EQ( crop_03( 0, 0 ), 507 );
+}
+
 /*
 TEST( Manipulation, Crop ) {
   ImageView<double> im(2,3); im(0,0)=1; im(1,0)=2; im(0,1)=3; im(1,1)=4; im(0,2)=5; im(1,2)=6;
@@ -0,0 +1,57 @@
+/**
+ * @file    TEST_palette_view.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/palette_view.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+namespace tx = tmns::image;
+
+/****************************************************/
+/*      Expand an index image through a palette     */
+/****************************************************/
+TEST( ops_palette_view, expand )
+{
+    std::vector<tx::PixelRGBA_u8> colors;
+    for( int i = 0; i < 4; i++ )
+    {
+        colors.push_back( tx::PixelRGBA_u8( i * 10, i * 20, i * 30, 255 ) );
+    }
+    auto palette = std::make_shared<const tx::Palette>( colors );
+    ASSERT_EQ( palette->size(), 4 );
+
+    tx::Image_Memory<uint8_t> indices( 40, 30 );
+    for( int r = 0; r < indices.rows(); r++ )
+    for( int c = 0; c < indices.cols(); c++ )
+    {
+        indices( c, r ) = ( r + c ) % 5;
+    }
+
+    auto view = tx::ops::palette_view( indices, palette );
+    ASSERT_EQ( view.cols(), 40 );
+    ASSERT_EQ( view.rows(), 30 );
+
+    // Rasterize a sub-region into memory
+    tmns::math::Rect2i bbox( 5, 5, 20, 10 );
+    tx::Image_Memory<tx::PixelRGBA_u8> expanded( bbox.width(), bbox.height() );
+    view.rasterize( expanded, bbox );
+
+    for( int r = 0; r < bbox.height(); r++ )
+    for( int c = 0; c < bbox.width(); c++ )
+    {
+        uint8_t index = indices( c + 5, r + 5 );
+        ASSERT_TRUE( expanded( c, r ) == (*palette)[index] );
+        ASSERT_TRUE( view( c + 5, r + 5 ) == (*palette)[index] );
+
+        // Indices past the palette are transparent black
+        if( index >= 4 )
+        {
+            ASSERT_EQ( expanded( c, r )[3], 0 );
+        }
+    }
+}
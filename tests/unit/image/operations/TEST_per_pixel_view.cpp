@@ -0,0 +1,215 @@
+/**
+ * @file    TEST_per_pixel_view.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/operations/per_pixel_views/per_pixel_view_unary.hpp>
+#include <terminus/image/types/for_each_pixel.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
+
+// C++ Libraries
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace tx = tmns::image;
+
+/**
+ * Doubles each pixel value, widening it to avoid overflow
+*/
+struct Double_Functor
+{
+    int operator()( uint8_t pix ) const
+    {
+        return 2 * pix;
+    }
+};
+
+/**
+ * Adds one to each pixel value
+*/
+struct Add_One_Functor
+{
+    int operator()( int pix ) const
+    {
+        return pix + 1;
+    }
+};
+
+/**
+ * Squares each pixel value, counting how often each overload is used
+*/
+struct Square_Batched_Functor
+{
+    int operator()( int pix ) const
+    {
+        ++(*single_calls);
+        return pix * pix;
+    }
+
+    void operator()( std::span<const int> input,
+                     std::span<int>       output ) const
+    {
+        ++(*batch_calls);
+        for( size_t i = 0; i < input.size(); ++i )
+        {
+            output[i] = input[i] * input[i];
+        }
+    }
+
+    std::shared_ptr<int> single_calls { std::make_shared<int>( 0 ) };
+    std::shared_ptr<int> batch_calls { std::make_shared<int>( 0 ) };
+};
+
+/****************************************************/
+/*      Per-pixel views produce whole rows at once  */
+/****************************************************/
+TEST( ops_per_pixel_view, row_access )
+{
+    tx::Image_Memory<uint8_t> image( 600, 20, 2 );
+    for( int p = 0; p < image.planes(); p++ )
+    for( int r = 0; r < image.rows(); r++ )
+    for( int c = 0; c < image.cols(); c++ )
+    {
+        image( c, r, p ) = ( r * 7 + c + p ) % 100;
+    }
+
+    typedef tx::ops::Per_Pixel_View_Unary<tx::Image_Memory<uint8_t>,Double_Functor> inner_type;
+    typedef tx::ops::Per_Pixel_View_Unary<inner_type,Add_One_Functor>                outer_type;
+    outer_type view{ inner_type( image ) };
+
+    // Memory exposes its rows directly; stacked views compute theirs in batches
+    ASSERT_TRUE(  tx::Has_Row_Span<tx::Image_Memory<uint8_t>::pixel_accessor>::value::value );
+    ASSERT_FALSE( tx::Has_Row_Span<outer_type::pixel_accessor>::value::value );
+    ASSERT_TRUE(  tx::Has_Row_Read<outer_type::pixel_accessor>::value::value );
+
+    // Rows wider than one batch, starting inside the image
+    tmns::math::Rect2i bbox( 30, 5, 520, 10 );
+    tx::Image_Memory<int> result( bbox.width(), bbox.height(), image.planes() );
+    view.rasterize( result, bbox );
+    for( int p = 0; p < result.planes(); p++ )
+    for( int r = 0; r < result.rows(); r++ )
+    for( int c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r, p ), view( c + bbox.min().x(), r + bbox.min().y(), p ) );
+    }
+
+    // Crops reuse the child accessor, so keep row access
+    auto cropped = tx::crop_image( view, bbox );
+    tx::Image_Memory<int> result_crop( bbox.width(), bbox.height(), image.planes() );
+    cropped.rasterize( result_crop, cropped.full_bbox() );
+    ASSERT_EQ( result_crop( 519, 9, 1 ), result( 519, 9, 1 ) );
+
+    // crop_image() may push the crop below the per-pixel views, so build the crop view itself
+    typedef tx::ops::Crop_View<outer_type> crop_type;
+    ASSERT_TRUE( tx::Has_Row_Read<crop_type::pixel_accessor>::value::value );
+
+    crop_type crop_view( view, bbox );
+    ASSERT_EQ( crop_view.cols(), bbox.width() );
+    ASSERT_EQ( crop_view.rows(), bbox.height() );
+
+    tx::Image_Memory<int> result_crop_view( bbox.width(), bbox.height(), image.planes() );
+    crop_view.rasterize( result_crop_view, crop_view.full_bbox() );
+    for( int p = 0; p < result.planes(); p++ )
+    for( int r = 0; r < result.rows(); r++ )
+    for( int c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_EQ( result_crop_view( c, r, p ), result( c, r, p ) );
+    }
+
+    // for_each_pixel visits every pixel of the computed rows
+    int64_t sum = 0;
+    int64_t expected = 0;
+    auto summer = [&]( int pix ){ sum += pix; };
+    tmns::core::utility::Progress_Callback_Null progress;
+    tx::for_each_pixel( view, summer, progress );
+    for( int p = 0; p < image.planes(); p++ )
+    for( int r = 0; r < image.rows(); r++ )
+    for( int c = 0; c < image.cols(); c++ )
+    {
+        expected += 2 * image( c, r, p ) + 1;
+    }
+    ASSERT_EQ( sum, expected );
+}
+
+/****************************************************/
+/*      Functors with a span overload are given     */
+/*      whole batches during rasterization          */
+/****************************************************/
+TEST( ops_per_pixel_view, batched_functor )
+{
+    tx::Image_Memory<int> image( 300, 4 );
+    for( int r = 0; r < image.rows(); r++ )
+    for( int c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = r + c;
+    }
+
+    ASSERT_TRUE(  ( tx::Has_Batched_Call<Square_Batched_Functor,int,int>::value::value ) );
+    ASSERT_FALSE( ( tx::Has_Batched_Call<Add_One_Functor,int,int>::value::value ) );
+
+    Square_Batched_Functor func;
+    tx::ops::Per_Pixel_View_Unary<tx::Image_Memory<int>,Square_Batched_Functor> view( image, func );
+
+    tx::Image_Memory<int> result( image.cols(), image.rows() );
+    view.rasterize( result, view.full_bbox() );
+    ASSERT_EQ( result( 299, 3 ), 302 * 302 );
+    ASSERT_EQ( result( 10, 2 ), 144 );
+
+    // One call per row, since memory rows are visited without batching
+    ASSERT_EQ( *func.batch_calls, image.rows() );
+    ASSERT_EQ( *func.single_calls, 0 );
+
+    // Single pixel access still uses the scalar overload
+    ASSERT_EQ( view( 3, 1 ), 16 );
+    ASSERT_EQ( *func.single_calls, 1 );
+}
+
+/****************************************************/
+/*      Stacked per-pixel views compose into one    */
+/*      and crops are pushed below them             */
+/****************************************************/
+TEST( ops_per_pixel_view, chain_simplification )
+{
+    tx::Image_Memory<uint8_t> image( 40, 30 );
+    for( int r = 0; r < image.rows(); r++ )
+    for( int c = 0; c < image.cols(); c++ )
+    {
+        image( c, r ) = ( r + c ) % 50;
+    }
+
+    auto view = tx::ops::per_pixel_view( tx::ops::per_pixel_view( image, Double_Functor() ),
+                                         Add_One_Functor() );
+    typedef tx::ops::Compose_Functor<Double_Functor,Add_One_Functor> compose_type;
+    static_assert( std::is_same_v<decltype( view ),
+                                  tx::ops::Per_Pixel_View_Unary<tx::Image_Memory<uint8_t>,compose_type>> );
+    ASSERT_EQ( view( 3, 4 ), 15 );
+
+    // Crops of crops of the view end up as one crop under the functor
+    auto cropped = tx::crop_image( tx::crop_image( view, 5, 6, 30, 20 ), 2, 2, 10, 10 );
+    static_assert( std::is_same_v<decltype( cropped ),
+                                  tx::ops::Per_Pixel_View_Unary<tx::ops::Crop_View<tx::Image_Memory<uint8_t>>,compose_type>> );
+    ASSERT_EQ( cropped.cols(), 10 );
+    ASSERT_EQ( cropped.rows(), 10 );
+
+    tx::Image_Memory<int> result( cropped.cols(), cropped.rows() );
+    cropped.rasterize( result, cropped.full_bbox() );
+    for( int r = 0; r < result.rows(); r++ )
+    for( int c = 0; c < result.cols(); c++ )
+    {
+        ASSERT_EQ( result( c, r ), 2 * image( c + 7, r + 8 ) + 1 );
+    }
+
+    // Composition with a batched functor keeps the batched path
+    Square_Batched_Functor square;
+    auto squared = tx::ops::per_pixel_view( view, square );
+    tx::Image_Memory<int> result_sq( squared.cols(), squared.rows() );
+    squared.rasterize( result_sq, squared.full_bbox() );
+    ASSERT_EQ( result_sq( 3, 4 ), 225 );
+    ASSERT_EQ( *square.batch_calls, squared.rows() );
+    ASSERT_EQ( *square.single_calls, 0 );
+}
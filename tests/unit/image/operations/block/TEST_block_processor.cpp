@@ -0,0 +1,105 @@
+/**
+ * @file    TEST_block_processor.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/block/block_processor.hpp>
+
+// C++ Libraries
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tx = tmns::image;
+
+/**
+ * Block function that records the blocks it processes and the hints it gets
+*/
+class Recording_Block_Functor
+{
+    public:
+
+        struct State
+        {
+            std::mutex                      mtx;
+            std::vector<tmns::math::Rect2i> processed;
+            std::vector<tmns::math::Rect2i> prefetched;
+        }; // End of State struct
+
+        Recording_Block_Functor()
+          : m_state( std::make_shared<State>() ) {}
+
+        void operator()( const tmns::math::Rect2i& bbox ) const
+        {
+            std::lock_guard<std::mutex> lock( m_state->mtx );
+            m_state->processed.push_back( bbox );
+        }
+
+        void prefetch( const tmns::math::Rect2i& bbox ) const
+        {
+            std::lock_guard<std::mutex> lock( m_state->mtx );
+            m_state->prefetched.push_back( bbox );
+        }
+
+        State& state() const { return *m_state; }
+
+    private:
+
+        std::shared_ptr<State> m_state;
+
+}; // End of Recording_Block_Functor class
+
+/**
+ * Count the blocks in a list that match a bbox
+*/
+size_t count_blocks( const std::vector<tmns::math::Rect2i>& blocks,
+                     const tmns::math::Rect2i&              bbox )
+{
+    return std::count_if( blocks.begin(), blocks.end(), [&]( const auto& block ) {
+        return block.min().x() == bbox.min().x() && block.min().y() == bbox.min().y() &&
+               block.width()   == bbox.width()   && block.height()  == bbox.height(); } );
+}
+
+/************************************************/
+/*      Upcoming blocks are hinted once each,   */
+/*      except the first one taken.             */
+/************************************************/
+TEST( ops_block_Block_Processor, prefetch_read_ahead )
+{
+    ASSERT_TRUE( tx::ops::block::Has_Prefetch<Recording_Block_Functor>::value::value );
+
+    const tmns::math::Rect2i bbox( 0, 0, 100, 70 );
+    for( size_t threads : { 1, 4 } )
+    {
+        Recording_Block_Functor functor;
+        tx::ops::block::Block_Processor<Recording_Block_Functor> process( functor,
+                                                                          tmns::math::Size2i( { 32, 32 } ),
+                                                                          threads,
+                                                                          3 );
+        process( bbox );
+
+        // 4 x 3 blocks, all processed, and all but the first hinted exactly once
+        auto& state = functor.state();
+        ASSERT_EQ( state.processed.size(), 12 );
+        ASSERT_EQ( state.prefetched.size(), 11 );
+        for( const auto& block : state.prefetched )
+        {
+            ASSERT_EQ( count_blocks( state.prefetched, block ), 1 );
+            ASSERT_EQ( count_blocks( state.processed, block ), 1 );
+        }
+        ASSERT_EQ( count_blocks( state.prefetched, tmns::math::Rect2i( 0, 0, 32, 32 ) ), 0 );
+    }
+
+    // Without read-ahead, no hints are given
+    Recording_Block_Functor functor;
+    tx::ops::block::Block_Processor<Recording_Block_Functor> process( functor,
+                                                                      tmns::math::Size2i( { 32, 32 } ),
+                                                                      1 );
+    process( bbox );
+    ASSERT_EQ( functor.state().processed.size(), 12 );
+    ASSERT_TRUE( functor.state().prefetched.empty() );
+}
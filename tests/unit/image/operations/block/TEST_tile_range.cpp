@@ -0,0 +1,107 @@
+/**
+ * @file    TEST_tile_range.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/block/tile_range.hpp>
+#include <terminus/image/types/image_memory.hpp>
+
+// Unit-Test Libraries
+#include "../../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
+namespace tx = tmns::image;
+
+/********************************************/
+/*      Walk an image in tiles with a       */
+/*      halo and several reader threads.    */
+/********************************************/
+TEST( ops_block_Tile_Range, tiles_with_halo )
+{
+    tx::Image_Memory<uint16_t> image_01( 250, 170 );
+    for( int r = 0; r < image_01.rows(); r++ )
+    for( int c = 0; c < image_01.cols(); c++ )
+    {
+        image_01( c, r ) = r * image_01.cols() + c;
+    }
+
+    const int halo = 4;
+    tx::Image_Memory<int> coverage( 250, 170 );
+    for( int r = 0; r < coverage.rows(); r++ )
+    for( int c = 0; c < coverage.cols(); c++ )
+    {
+        coverage( c, r ) = 0;
+    }
+
+    size_t expected_index = 0;
+    for( auto& tile : tx::tiles( image_01, tmns::math::Size2i( { 64, 64 } ), halo, 3 ) )
+    {
+        ASSERT_EQ( tile.index(), expected_index++ );
+
+        const auto& bbox      = tile.bbox();
+        const auto& halo_bbox = tile.halo_bbox();
+        ASSERT_EQ( tile.image().cols(), halo_bbox.width() );
+        ASSERT_EQ( tile.image().rows(), halo_bbox.height() );
+        ASSERT_EQ( halo_bbox.min().x(), std::max( 0, bbox.min().x() - halo ) );
+        ASSERT_EQ( halo_bbox.min().y(), std::max( 0, bbox.min().y() - halo ) );
+
+        for( int r = 0; r < halo_bbox.height(); r++ )
+        for( int c = 0; c < halo_bbox.width();  c++ )
+        {
+            ASSERT_EQ( tile.image()( c, r ),
+                       image_01( halo_bbox.min().x() + c, halo_bbox.min().y() + r ) );
+        }
+
+        for( int r = bbox.min().y(); r < bbox.max().y(); r++ )
+        for( int c = bbox.min().x(); c < bbox.max().x(); c++ )
+        {
+            coverage( c, r ) += 1;
+        }
+    }
+
+    // 4 x 3 tiles, and every pixel lands in exactly one core region
+    ASSERT_EQ( expected_index, 12 );
+    for( int r = 0; r < coverage.rows(); r++ )
+    for( int c = 0; c < coverage.cols(); c++ )
+    {
+        ASSERT_EQ( coverage( c, r ), 1 );
+    }
+}
+
+/********************************************/
+/*      Resources without block reads are   */
+/*      streamed in bounded tiles.          */
+/********************************************/
+TEST( ops_block_Tile_Range, tiles_without_block_read )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 600, 300, tmns::math::Size2i( { 600, 300 } ) );
+
+    tx::Image_Memory<uint16_t> source( 600, 300 );
+    for( int r = 0; r < source.rows(); r++ )
+    for( int c = 0; c < source.cols(); c++ )
+    {
+        source( c, r ) = r * 100 + c;
+    }
+    ASSERT_FALSE( resource->write( source.buffer(), source.full_bbox() ).has_error() );
+    ASSERT_FALSE( resource->has_block_read() );
+
+    size_t num_tiles = 0;
+    for( auto& tile : tx::tiles<uint16_t>( resource ) )
+    {
+        const auto& bbox = tile.bbox();
+        ASSERT_LE( bbox.width(),  tx::ops::block::DEFAULT_RESOURCE_TILE_SIZE );
+        ASSERT_LE( bbox.height(), tx::ops::block::DEFAULT_RESOURCE_TILE_SIZE );
+
+        for( int r = 0; r < bbox.height(); r++ )
+        for( int c = 0; c < bbox.width();  c++ )
+        {
+            ASSERT_EQ( tile.image()( c, r ), source( bbox.min().x() + c, bbox.min().y() + r ) );
+        }
+        ++num_tiles;
+    }
+
+    // 3 x 2 tiles rather than one tile covering the whole image
+    ASSERT_EQ( num_tiles, 6 );
+}
@@ -31,4 +31,42 @@ TEST( image_convert, channel_convert_int_to_float )
         ASSERT_NEAR( flt32_arr[i], flt32_exp[i], 0.001 );
     }
 
-}
\ No newline at end of file
+}
+/****************************************/
+/*      Convert with Nodata Masking     */
+/****************************************/
+TEST( image_convert, convert_masked_nodata )
+{
+    namespace tx = tmns::image;
+
+    std::array<uint16_t,4> src_data { 0, 7, 0, 9 };
+    std::array<float,8>    dst_data {};
+
+    tx::Image_Buffer src( tx::Image_Format( 4, 1, 1,
+                                            tx::Pixel_Format_Enum::GRAY,
+                                            tx::Channel_Type_Enum::UINT16,
+                                            false ),
+                          src_data.data() );
+    tx::Image_Buffer dst( tx::Image_Format( 4, 1, 1,
+                                            tx::Pixel_Format_Enum::GRAY_MASKED,
+                                            tx::Channel_Type_Enum::FLOAT32,
+                                            false ),
+                          dst_data.data() );
+
+    ASSERT_FALSE( tx::convert_masked( dst, src, 0.0 ).has_error() );
+
+    std::array<float,8> exp_data { 0, 0, 7, 1, 0, 0, 9, 1 };
+    for( size_t i = 0; i < exp_data.size(); i++ )
+    {
+        ASSERT_NEAR( dst_data[i], exp_data[i], 0.001 );
+    }
+
+    // Without nodata, every pixel is valid
+    dst_data.fill( 0 );
+    ASSERT_FALSE( tx::convert( dst, src ).has_error() );
+    for( size_t i = 0; i < 4; i++ )
+    {
+        ASSERT_NEAR( dst_data[2*i],   src_data[i], 0.001 );
+        ASSERT_NEAR( dst_data[2*i+1], 1, 0.001 );
+    }
+}
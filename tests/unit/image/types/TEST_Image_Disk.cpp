@@ -9,6 +9,7 @@
 #include <terminus/image/pixel/Pixel_Gray.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/types/Image_Disk.hpp>
+#include <terminus/image/types/Image_Memory.hpp>
 #include <terminus/log/utility.hpp>
 
 namespace tx = tmns::image;
@@ -61,4 +62,30 @@ TEST( types_Image_Disk, construct_gdal_resource_jpg )
     ASSERT_EQ( disk_image_02.format().rows(), 512 );
     ASSERT_EQ( disk_image_02.format().channel_type(), tx::Channel_Type_Enum::FLOAT64 );
     ASSERT_EQ( disk_image_02.format().pixel_type(), tx::Pixel_Format_Enum::GRAY );
-}
\ No newline at end of file
+}
+/****************************************************/
+/*      Copies keep the merged resource metadata    */
+/****************************************************/
+TEST( types_Image_Disk, copy_payload_metadata )
+{
+    std::filesystem::path image_to_load { "./data/images/jpeg/lena.jpg" };
+
+    auto resource = std::make_shared<tx::io::gdal::Image_Resource_Disk_GDAL>( image_to_load );
+    auto cache = std::make_shared<tmns::core::cache::Cache_Local>( 1000000000 );
+
+    // Nothing has asked for the metadata yet
+    tx::Image_Disk<tx::PixelRGBA_u8> disk_image( resource, cache );
+    ASSERT_FALSE( disk_image.has_payload() );
+
+    // Rasterizing carries the resource metadata over
+    tx::Image_Memory<tx::PixelRGBA_u8> image_01;
+    image_01 = disk_image;
+    ASSERT_TRUE( image_01.has_payload() );
+    ASSERT_EQ( image_01.metadata()->get<std::string>( "file_driver" ).value(), "JPEG" );
+
+    // Payload transfers merge it as well
+    tx::Image_Disk<tx::PixelRGBA_u8> disk_image_02( resource, cache );
+    tx::Image_Memory<tx::PixelRGBA_u8> image_02( 10, 10, 1 );
+    image_02.copy_payload_data( disk_image_02 );
+    ASSERT_EQ( image_02.metadata()->get<std::string>( "file_driver" ).value(), "JPEG" );
+}
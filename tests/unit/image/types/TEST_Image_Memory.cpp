@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 // Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/types/Image_Memory.hpp>
 
@@ -32,4 +33,125 @@ TEST( Image_Memory, basic_checks_RGBA_uint8 )
     ASSERT_EQ( buffer_01.channel_type(), tx::Channel_Type_Enum::UINT8 );
 
     tmns::log::trace( buffer_01.to_string() );
-}
\ No newline at end of file
+}
+/**********************************************/
+/*      Metadata and interest points are      */
+/*      only created when first used.         */
+/**********************************************/
+TEST( Image_Memory, lazy_payload )
+{
+    tx::Image_Memory<tx::PixelRGBA_u8> image_01( 10, 10, 1 );
+    ASSERT_FALSE( image_01.has_payload() );
+
+    // Copies of an image without a payload stay without one
+    auto image_02 = image_01;
+    ASSERT_FALSE( image_02.has_payload() );
+
+    // Metadata is created on first access, then reused
+    auto metadata = image_01.metadata();
+    ASSERT_TRUE( image_01.has_payload() );
+    ASSERT_EQ( image_01.metadata(), metadata );
+
+    // Copies share the metadata container
+    auto image_03 = image_01;
+    ASSERT_TRUE( image_03.has_payload() );
+    ASSERT_EQ( image_03.metadata(), metadata );
+
+    // Payload transfers share the container too
+    tx::Image_Memory<tx::PixelRGBA_u8> image_04( 10, 10, 1 );
+    image_04.copy_payload_data( image_01 );
+    ASSERT_EQ( image_04.metadata(), metadata );
+
+    image_04.copy_payload_data( image_02 );
+    ASSERT_FALSE( image_04.has_payload() );
+}
+
+/**********************************************/
+/*      Moves, deep copies, and detaching     */
+/**********************************************/
+TEST( Image_Memory, copy_semantics )
+{
+    tx::Image_Memory<uint8_t> image_01( 4, 4, 1 );
+    image_01( 1, 1 ) = 10;
+
+    // Copies share pixels
+    auto image_02 = image_01;
+    ASSERT_EQ( image_02.data(), image_01.data() );
+    ASSERT_FALSE( image_01.unique() );
+
+    // Deep copies do not
+    auto image_03 = image_01.deep_copy();
+    ASSERT_NE( image_03.data(), image_01.data() );
+    ASSERT_TRUE( image_03.unique() );
+    ASSERT_EQ( image_03( 1, 1 ), 10 );
+
+    // Detaching copies only while shared
+    ASSERT_FALSE( image_02.detach().has_error() );
+    ASSERT_NE( image_02.data(), image_01.data() );
+    image_02( 1, 1 ) = 20;
+    ASSERT_EQ( image_01( 1, 1 ), 10 );
+
+    auto* data = image_02.data();
+    ASSERT_FALSE( image_02.detach().has_error() );
+    ASSERT_EQ( image_02.data(), data );
+
+    // Moves take the pixels and leave the source empty
+    tx::Image_Memory<uint8_t> image_04( std::move( image_02 ) );
+    ASSERT_EQ( image_04.data(), data );
+    ASSERT_FALSE( image_02.is_valid_image() );
+    ASSERT_EQ( image_02.cols(), 0 );
+
+    image_03 = std::move( image_04 );
+    ASSERT_EQ( image_03.data(), data );
+    ASSERT_EQ( image_03( 1, 1 ), 20 );
+
+    // Assigning a view into a shared image leaves the other image alone
+    tx::Image_Memory<uint8_t> image_05( 4, 4, 1 );
+    image_05( 1, 1 ) = 30;
+    tx::Image_Memory<uint8_t> image_06;
+    image_06 = image_05;
+    image_06 = tx::crop_image( image_03, tmns::math::Rect2i( 0, 0, 4, 4 ) );
+    ASSERT_NE( image_06.data(), image_05.data() );
+    ASSERT_NE( image_06.data(), image_03.data() );
+    ASSERT_EQ( image_06( 1, 1 ), 20 );
+    ASSERT_EQ( image_05( 1, 1 ), 30 );
+}
+
+/**********************************************/
+/*      Test the large buffer placement       */
+/**********************************************/
+TEST( Image_Memory, allocation_policy )
+{
+    tx::Allocation_Policy policy;
+    policy.huge_pages = true;
+    policy.interleave = true;
+    policy.min_bytes  = 4096;
+
+    // Mapped pixels start out default-constructed, even when left untouched
+    tx::Image_Memory<tx::PixelRGBA_u8> image( 1024, 512, 1, policy );
+    ASSERT_TRUE( image.is_valid_image() );
+    ASSERT_TRUE( image.allocation_policy().huge_pages );
+    ASSERT_EQ( image( 1000, 500 ), tx::PixelRGBA_u8() );
+
+    image( 1000, 500 ) = tx::PixelRGBA_u8( 1, 2, 3, 4 );
+    ASSERT_EQ( image( 1000, 500 ), tx::PixelRGBA_u8( 1, 2, 3, 4 ) );
+
+    // Copies keep the policy through detach()
+    auto copy = image;
+    ASSERT_FALSE( copy.detach().has_error() );
+    ASSERT_EQ( copy( 1000, 500 ), tx::PixelRGBA_u8( 1, 2, 3, 4 ) );
+    ASSERT_TRUE( copy.allocation_policy().interleave );
+
+    // Assignment takes the policy too, as the constructors do
+    tx::Image_Memory<tx::PixelRGBA_u8> assigned( 4, 4 );
+    ASSERT_FALSE( assigned.allocation_policy().huge_pages );
+    assigned = image;
+    ASSERT_TRUE( assigned.allocation_policy().huge_pages );
+    ASSERT_TRUE( assigned.allocation_policy().interleave );
+    ASSERT_EQ( assigned.allocation_policy().min_bytes, 4096 );
+
+    tx::Image_Memory<tx::PixelRGBA_u8> moved( 4, 4 );
+    moved = std::move( copy );
+    ASSERT_TRUE( moved.allocation_policy().huge_pages );
+    ASSERT_EQ( moved( 1000, 500 ), tx::PixelRGBA_u8( 1, 2, 3, 4 ) );
+}
@@ -7,9 +7,13 @@
 
 // Terminus Libraries
 #include <terminus/image/pixel/Pixel_Gray.hpp>
+#include <terminus/image/pixel/pixel_mask.hpp>
 #include <terminus/image/pixel/Pixel_RGBA.hpp>
 #include <terminus/image/types/Image_Resource_View.hpp>
 
+// Unit-Test Libraries
+#include "../../UNIT_TEST_ONLY/Recording_Image_Resource.hpp"
+
 namespace tx = tmns::image;
 
 /******************************************************************/
@@ -72,4 +76,59 @@ TEST( types_Image_Resource_View, simple_test_disk_gdal_jpg )
     ASSERT_EQ( view_02.format().channel_type(), tx::Channel_Type_Enum::FLOAT64 );
     ASSERT_EQ( view_02.format().pixel_type(), tx::Pixel_Format_Enum::GRAY );
 
-}
\ No newline at end of file
+}
+
+/******************************************************************/
+/*      Pixel access reads each tile from the resource once       */
+/******************************************************************/
+TEST( types_Image_Resource_View, pixel_access_tile_cache )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint16_t>>( 300, 80, tmns::math::Size2i( { 300, 80 } ) );
+
+    tx::Image_Memory<uint16_t> source( 300, 80 );
+    for( int r = 0; r < 80;  ++r ) {
+    for( int c = 0; c < 300; ++c ) {
+        source( c, r ) = static_cast<uint16_t>( r * 300 + c );
+    }}
+    ASSERT_FALSE( resource->write( source.buffer(), source.full_bbox() ).has_error() );
+
+    // The recording resource does not claim thread-safe reads
+    tx::Image_Resource_View<uint16_t> view( resource );
+    ASSERT_FALSE( view.has_concurrent_read() );
+    for( int r = 0; r < 80;  ++r ) {
+    for( int c = 0; c < 300; ++c ) {
+        ASSERT_EQ( view( c, r ), r * 300 + c );
+    }}
+
+    // Two default-sized tiles span the width
+    ASSERT_EQ( resource->read_order().size(), 2 );
+    ASSERT_EQ( resource->read_order()[0].to_string(), tmns::math::Rect2i( 0,   0, 256, 80 ).to_string() );
+    ASSERT_EQ( resource->read_order()[1].to_string(), tmns::math::Rect2i( 256, 0, 44,  80 ).to_string() );
+}
+
+/******************************************************************/
+/*      The fill pixel is converted like the data, so masked      */
+/*      views mark it invalid only when it is nodata.             */
+/******************************************************************/
+TEST( types_Image_Resource_View, fill_pixel_conversion )
+{
+    auto resource = std::make_shared<Recording_Image_Resource<uint8_t>>( 32, 32, tmns::math::Size2i( { 32, 32 } ) );
+    resource->mark_empty( tmns::math::Rect2i( 0, 0, 32, 32 ) );
+
+    // Without nodata, empty regions read back as valid zeros
+    tx::Image_Resource_View<tx::Pixel_Mask<tx::PixelGray_u8>> masked( resource );
+    ASSERT_TRUE( masked.has_empty_regions() );
+    auto fill = masked.fill_pixel();
+    ASSERT_EQ( fill.child()[0], 0 );
+    ASSERT_TRUE( fill.valid() );
+
+    tx::Image_Resource_View<float> floats( resource );
+    ASSERT_EQ( floats.fill_pixel(), 0 );
+
+    // With nodata, the value is converted and masked pixels are invalid
+    resource->set_nodata_read( 200 );
+    fill = masked.fill_pixel();
+    ASSERT_EQ( fill.child()[0], 200 );
+    ASSERT_FALSE( fill.valid() );
+    ASSERT_EQ( floats.fill_pixel(), 200 );
+}
@@ -0,0 +1,56 @@
+/**
+ * @file    TEST_Image_Scratch.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_scratch.hpp>
+
+namespace tx = tmns::image;
+
+/**********************************************/
+/*      Read and write a file-backed image    */
+/**********************************************/
+TEST( Image_Scratch, read_write )
+{
+    tx::Image_Scratch<uint16_t> image_01( 300, 200, 2 );
+    ASSERT_TRUE( image_01.is_valid_image() );
+    ASSERT_EQ( image_01.cols(), 300 );
+    ASSERT_EQ( image_01.rows(), 200 );
+    ASSERT_EQ( image_01.planes(), 2 );
+
+    // Scratch files start out zeroed
+    ASSERT_EQ( image_01( 299, 199, 1 ), 0 );
+
+    for( size_t p = 0; p < 2;   ++p ) {
+    for( size_t r = 0; r < 200; ++r ) {
+    for( size_t c = 0; c < 300; ++c ) {
+        image_01( c, r, p ) = static_cast<uint16_t>( p * 1000 + r + c );
+    }}}
+
+    // Rasterize a region into memory
+    tx::Image_Memory<uint16_t> image_02 = tx::crop_image( image_01, tmns::math::Rect2i( 10, 20, 30, 40 ) );
+    ASSERT_EQ( image_02.cols(), 30 );
+    ASSERT_EQ( image_02.rows(), 40 );
+    ASSERT_EQ( image_02( 0, 0, 1 ), 1000 + 20 + 10 );
+    ASSERT_EQ( image_02( 29, 39, 0 ), 39 + 20 + 29 + 10 );
+
+    // And back into a scratch image
+    tx::Image_Scratch<uint16_t> image_03( image_02 );
+    ASSERT_EQ( image_03( 29, 39, 0 ), image_02( 29, 39, 0 ) );
+
+    // Converting from another image honors the scratch directory
+    auto scratch_dir = std::filesystem::temp_directory_path() / "terminus_scratch_test";
+    std::filesystem::create_directories( scratch_dir );
+    tx::Image_Scratch<uint16_t> image_04( image_02, scratch_dir );
+    ASSERT_EQ( image_04( 29, 39, 1 ), image_02( 29, 39, 1 ) );
+    std::filesystem::remove_all( scratch_dir );
+    ASSERT_THROW( tx::Image_Scratch<uint16_t>( image_02, scratch_dir ), std::runtime_error );
+
+    image_01.reset();
+    ASSERT_FALSE( image_01.is_valid_image() );
+}
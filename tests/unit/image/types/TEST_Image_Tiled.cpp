@@ -0,0 +1,74 @@
+/**
+ * @file    TEST_Image_Tiled.cpp
+ * @author  Marvin Smith
+ * @date    10/18/2026
+*/
+#include <gtest/gtest.h>
+
+// Terminus Libraries
+#include <terminus/image/operations/crop_image.hpp>
+#include <terminus/image/types/image_memory.hpp>
+#include <terminus/image/types/image_tiled.hpp>
+
+namespace tx = tmns::image;
+
+/**********************************************/
+/*      Tiled layout and tile access          */
+/**********************************************/
+TEST( Image_Tiled, layout )
+{
+    // Edge tiles are partial in both directions
+    tx::Image_Tiled<uint16_t,16> image_01( 40, 20, 2 );
+    ASSERT_EQ( image_01.cols(), 40 );
+    ASSERT_EQ( image_01.rows(), 20 );
+    ASSERT_EQ( image_01.planes(), 2 );
+    ASSERT_EQ( image_01.tiles_per_row(), 3 );
+    ASSERT_EQ( image_01.tiles_per_col(), 2 );
+    ASSERT_EQ( image_01( 39, 19, 1 ), 0 );
+
+    for( size_t p = 0; p < 2;  ++p ) {
+    for( size_t r = 0; r < 20; ++r ) {
+    for( size_t c = 0; c < 40; ++c ) {
+        image_01( c, r, p ) = static_cast<uint16_t>( p * 1000 + r * 40 + c );
+    }}}
+
+    // Pixels of a tile are contiguous
+    ASSERT_EQ( image_01.tile_bbox( 2, 1 ).to_string(), tmns::math::Rect2i( 32, 16, 8, 4 ).to_string() );
+    const uint16_t* tile = image_01.tile_data( 1, 0, 1 );
+    ASSERT_EQ( tile[0],       1000 + 16 );
+    ASSERT_EQ( tile[16 + 1],  1000 + 40 + 17 );
+
+    // The accessor walks the tiled layout
+    auto acc = image_01.origin().advance( 15, 3, 1 );
+    ASSERT_EQ( *acc, 1000 + 3 * 40 + 15 );
+    acc.next_col();
+    ASSERT_EQ( *acc, 1000 + 3 * 40 + 16 );
+}
+
+/**********************************************/
+/*      Rasterize to and from memory          */
+/**********************************************/
+TEST( Image_Tiled, rasterize )
+{
+    tx::Image_Memory<float> image_01( 100, 70 );
+    for( size_t r = 0; r < 70;  ++r ) {
+    for( size_t c = 0; c < 100; ++c ) {
+        image_01( c, r ) = static_cast<float>( r * 100 + c );
+    }}
+
+    tx::Image_Tiled<float> image_02( image_01 );
+
+    // A region spanning several tiles
+    tx::Image_Memory<float> image_03 = tx::crop_image( image_02, tmns::math::Rect2i( 50, 30, 40, 38 ) );
+    ASSERT_EQ( image_03.cols(), 40 );
+    ASSERT_EQ( image_03.rows(), 38 );
+    for( size_t r = 0; r < 38; ++r ) {
+    for( size_t c = 0; c < 40; ++c ) {
+        ASSERT_EQ( image_03( c, r ), image_01( c + 50, r + 30 ) );
+    }}
+
+    // Converting on the way out
+    tx::Image_Memory<double> image_04( 100, 70 );
+    image_02.rasterize( image_04, image_02.full_bbox() );
+    ASSERT_EQ( image_04( 99, 69 ), 69 * 100 + 99 );
+}